@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 Enzo Belmonte
+# SPDX-License-Identifier: MIT
+"""
+Reconstruye el texto de la bitácora binaria (make BITACORA=<nivel>).
+
+Lee los formatos de la sección .bitacora_fmt del ELF y los registros que la UART de la
+bitácora dejó en lst/bitacora.bin. Ver inc/kernel/bitacora.h para el formato del registro.
+
+Uso: bitacora.py obj/bios.elf lst/bitacora.bin [--nivel N]
+"""
+import argparse
+import re
+import struct
+import sys
+
+SINCRO = 0xB1
+MAX_ARGS = 8
+NIVELES = {1: "ERROR", 2: "AVISO", 3: "INFO", 4: "DEPURAR"}
+SHT_PROGBITS = 1
+SHF_ALLOC = 2
+
+CONVERSION = re.compile(r"%([-+ #0]*)(\d*|\*)(?:\.(\d*))?(hh|h|ll|l|z|j|t)?([diouxXcsp%])")
+
+
+def leer_elf(ruta):
+    """Devuelve los formatos y las secciones cargadas (para %s) de un ELF32 little-endian."""
+    with open(ruta, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF" or elf[4] != 1 or elf[5] != 1:
+        sys.exit(f"{ruta}: no es un ELF32 little-endian")
+    e_shoff, = struct.unpack_from("<I", elf, 0x20)
+    e_shentsize, e_shnum, e_shstrndx = struct.unpack_from("<HHH", elf, 0x2E)
+
+    secciones = []
+    for i in range(e_shnum):
+        nombre, tipo, flags, addr, offset, tam = struct.unpack_from("<IIIIII", elf, e_shoff + i * e_shentsize)
+        secciones.append((nombre, tipo, flags, addr, offset, tam))
+    strtab = secciones[e_shstrndx]
+
+    def nombre_de(sec):
+        ini = strtab[4] + sec[0]
+        return elf[ini:elf.index(b"\0", ini)].decode()
+
+    formatos = None
+    cargadas = []
+    for sec in secciones:
+        _, tipo, flags, addr, offset, tam = sec
+        if nombre_de(sec) == ".bitacora_fmt":
+            formatos = elf[offset:offset + tam]
+        elif tipo == SHT_PROGBITS and flags & SHF_ALLOC:
+            cargadas.append((addr, elf[offset:offset + tam]))
+    if formatos is None:
+        sys.exit(f"{ruta}: no tiene .bitacora_fmt (¿se compiló con BITACORA?)")
+    return formatos, cargadas
+
+
+def cadena(datos, ini):
+    fin = datos.find(b"\0", ini)
+    return datos[ini:fin if fin >= 0 else len(datos)].decode("utf-8", "replace")
+
+
+def cadena_en(cargadas, addr):
+    for base, datos in cargadas:
+        if base <= addr < base + len(datos):
+            return cadena(datos, addr - base)
+    return f"<0x{addr:08x}>"
+
+
+def formatear(fmt, args, cargadas):
+    pendientes = list(args)
+
+    def reemplazar(m):
+        flags, ancho, prec, _, conv = m.groups()
+        if conv == "%":
+            return "%"
+        arg = pendientes.pop(0) if pendientes else 0
+        espec = "%" + flags + ancho + ("." + prec if prec is not None else "")
+        if conv in "di":
+            return (espec + "d") % (arg - (1 << 32) if arg & 0x80000000 else arg)
+        if conv == "c":
+            return (espec + "c") % chr(arg & 0xFF)
+        if conv == "s":
+            return (espec + "s") % cadena_en(cargadas, arg)
+        if conv == "p":
+            return "0x%08x" % arg
+        return (espec + conv) % arg
+
+    return CONVERSION.sub(reemplazar, fmt)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Reconstruye el texto de la bitácora binaria")
+    parser.add_argument("elf", help="ELF con la sección .bitacora_fmt (obj/bios.elf)")
+    parser.add_argument("registros", help="flujo de registros de la UART de la bitácora, o - para stdin")
+    parser.add_argument("--nivel", type=int, default=4, help="muestra los registros de este nivel o más graves")
+    opts = parser.parse_args()
+
+    formatos, cargadas = leer_elf(opts.elf)
+    if opts.registros == "-":
+        flujo = sys.stdin.buffer.read()
+    else:
+        with open(opts.registros, "rb") as f:
+            flujo = f.read()
+
+    pos = 0
+    cant = 0
+    descartados = 0
+    bytes_texto = 0
+    vueltas = 0
+    anterior = 0
+    while pos + 8 <= len(flujo):
+        cabecera, tiempo = struct.unpack_from("<II", flujo, pos)
+        nargs = (cabecera >> 8) & 0xF
+        nivel = (cabecera >> 12) & 0xF
+        indice = cabecera >> 16
+        largo = 8 + 4 * nargs
+        valido = ((cabecera & 0xFF) == SINCRO and nargs <= MAX_ARGS and nivel in NIVELES
+                  and indice < len(formatos) and (indice == 0 or formatos[indice - 1] == 0)
+                  and pos + largo <= len(flujo))
+        if not valido:
+            # Se perdió la sincronización: busco la próxima marca
+            pos += 1
+            descartados += 1
+            continue
+
+        args = struct.unpack_from("<%dI" % nargs, flujo, pos + 8)
+        pos += largo
+        cant += 1
+        if tiempo < anterior:
+            vueltas += 1  # El contador de 32 bits en us da la vuelta cada ~71 minutos
+        anterior = tiempo
+        texto = formatear(cadena(formatos, indice), args, cargadas)
+        bytes_texto += len(texto.encode())
+        if nivel <= opts.nivel:
+            us = (vueltas << 32) + tiempo
+            sys.stdout.write("[%6d.%06d] %-7s %s" % (us // 1000000, us % 1000000, NIVELES[nivel], texto))
+            if not texto.endswith("\n"):
+                sys.stdout.write("\n")
+
+    sys.stderr.write("%d registros, %d bytes recibidos, %d bytes de texto, %d bytes descartados\n"
+                     % (cant, pos - descartados, bytes_texto, descartados))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    bench.h
+ * @brief   Declaración de la imagen de benchmark: ciclos por función del kernel medidos con la PMU
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdint.h>
+
+#define BENCH_REPETICIONES 32U // Potencia de 2: el promedio se calcula con un desplazamiento
+#define BENCH_REPETICIONES_LOG2 5U
+
+typedef struct
+{
+    const char *nombre;
+    void (*funcion)(void);
+} bench_caso_t;
+
+/*!
+ * @brief Mide cada caso BENCH_REPETICIONES veces con el contador de ciclos e imprime mínimo y promedio.
+ *        Se llama al final de board_init, con las IRQ todavía deshabilitadas.
+ *        Al costo de cada caso ya se le descontó el de una llamada vacía.
+ *
+ * @return None
+ */
+void bench_run(void);
+
+#endif // BENCH_H_
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    boot_prof.h
+ * @brief   Declaración de funciones para medir el tiempo de cada fase del arranque
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef BOOT_PROF_H_
+#define BOOT_PROF_H_
+
+#include <stdint.h>
+
+// Los indices deben coincidir con los .equ BOOT_PHASE_* de startup.s
+typedef enum
+{
+    BOOT_PHASE_RESET = 0,
+    BOOT_PHASE_STACKS,
+    BOOT_PHASE_VECTORS,
+    BOOT_PHASE_GIC,
+    BOOT_PHASE_TIMER,
+    BOOT_PHASE_UART,
+    BOOT_PHASE_KMEM,
+    BOOT_PHASE_SCHEDULER,
+    BOOT_PHASE_FIRST_TASK,
+    BOOT_PHASE_CANT,
+} boot_phase_t;
+
+/*!
+ * @brief Marcas de tiempo (ciclos de CPU) tomadas al finalizar cada fase.
+ */
+extern uint32_t boot_prof_ts[BOOT_PHASE_CANT];
+
+/*!
+ * @brief Registra el contador de ciclos al finalizar una fase del arranque.
+ *
+ * @param[in] fase Fase que acaba de finalizar.
+ * @return None
+ */
+void boot_prof_mark(boot_phase_t fase);
+
+/*!
+ * @brief Imprime por UART el reporte de tiempos de arranque.
+ *
+ * @return None
+ */
+void boot_prof_report(void);
+
+/*!
+ * @brief Encola boot_prof_report en la workqueue, para no imprimir con las IRQ deshabilitadas.
+ *
+ * @return None
+ */
+void boot_prof_report_diferido(void);
+
+#endif // BOOT_PROF_H_
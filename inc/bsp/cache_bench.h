@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    cache_bench.h
+ * @brief   Declaración de la medición de fallos de la cache L1 con la PMU
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef CACHE_BENCH_H_
+#define CACHE_BENCH_H_
+
+#include <stdint.h>
+
+// Ticks de medición; 0 la deshabilita (make CACHE_BENCH=<ticks>)
+#ifndef CACHE_BENCH_TICKS
+#define CACHE_BENCH_TICKS 0
+#endif
+
+#if CACHE_BENCH_TICKS > 0 && !defined(CACHE)
+#error "CACHE_BENCH necesita las caches habilitadas (CACHE=1)"
+#endif
+
+// Ticks que se descartan antes de medir: arranque y primeras pasadas de cada tarea
+#define CACHE_BENCH_CALENTAMIENTO 50U
+
+typedef enum
+{
+    CACHE_EV_L1D_FALLOS = 0,
+    CACHE_EV_L1D_ACCESOS,
+    CACHE_EV_L1I_FALLOS,
+    CACHE_EV_INSTR,
+    CACHE_EV_CANT,
+} cache_evento_t;
+
+typedef struct
+{
+    uint32_t ticks;
+    uint32_t inicio[CACHE_EV_CANT];
+    uint32_t cuenta[CACHE_EV_CANT]; // Diferencia al terminar la ventana
+    volatile uint8_t terminado;
+} cache_bench_cpu_t;
+
+/*!
+ * @brief Programa los contadores de eventos de la CPU local. Cada CPU la llama al inicializarse.
+ *
+ * @return None
+ */
+void cache_bench_init(void);
+
+/*!
+ * @brief Avanza la ventana de medición de la CPU local. Se llama desde la softirq del timer.
+ *        Cuando todas las CPUs terminan, la CPU0 encola el reporte.
+ *
+ * @return None
+ */
+void cache_bench_tick(void);
+
+/*!
+ * @brief Imprime por CPU la tasa de fallos de la L1 de datos y los fallos de la L1 de instrucciones
+ *        cada 1000 instrucciones, junto con el layout con que se compiló.
+ *
+ * @return None
+ */
+void cache_bench_report(void);
+
+#endif // CACHE_BENCH_H_
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    irq_lat.h
+ * @brief   Declaración del banco de medición de latencia y jitter de interrupciones
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef IRQ_LAT_H_
+#define IRQ_LAT_H_
+
+#include <stdint.h>
+
+// Cantidad de muestras a tomar. 0 deshabilita la medición (make IRQ_LAT=<muestras>).
+#ifndef IRQ_LAT_MUESTRAS
+#define IRQ_LAT_MUESTRAS 0
+#endif
+
+#if IRQ_LAT_MUESTRAS > 0 && defined(SMP)
+#error "La medición de latencia usa el TIMER1 de la realview-pb-a8: no está soportada con SMP"
+#endif
+
+#define IRQ_LAT_TIMER_ADDR TIMER1_ADDR // SP804 libre: canal 1 periódico, reloj de 1 MHz
+
+// Período base en us más una parte pseudoaleatoria, para no quedar en fase con el tick
+#define IRQ_LAT_PERIODO_BASE 700U
+#define IRQ_LAT_PERIODO_MASCARA 0x1FFU
+
+// Histograma de 1 us por barra; la última acumula todo lo que la supera
+#define IRQ_LAT_HIST_CANT 64U
+
+#define IRQ_LAT_GICD_ISENABLER(n) (*(volatile uint32_t *)(GICD0_ADDR + 0x100U + 4U * (n)))
+
+typedef struct
+{
+    uint32_t muestras;
+    uint32_t min;
+    uint32_t max;
+    uint32_t suma;
+    uint32_t carga;    // Valor de recarga vigente del contador
+    uint32_t semilla;  // LFSR para variar el período
+    uint32_t hist[IRQ_LAT_HIST_CANT];
+} irq_lat_t;
+
+/*!
+ * @brief Habilita TIMER1 en modo periódico y su interrupción en el GIC.
+ *
+ * @return None
+ */
+void irq_lat_init(void);
+
+/*!
+ * @brief Lee el contador del timer de medición. Se llama al entrar a C_IRQ_handler.
+ *
+ * @return Valor del contador (descendente) en el momento de la lectura.
+ */
+uint32_t irq_lat_entrada(void);
+
+/*!
+ * @brief Atiende la interrupción de TIMER1 y registra la latencia de la muestra.
+ *        Con la última muestra detiene el timer e imprime el reporte.
+ *
+ * @param[in] valor Contador leído con irq_lat_entrada al entrar al manejador.
+ * @return None
+ */
+void irq_lat_muestra(uint32_t valor);
+
+/*!
+ * @brief Imprime por UART mínimo, promedio, máximo, percentil 99 e histograma, en us.
+ *
+ * @return None
+ */
+void irq_lat_report(void);
+
+#endif // IRQ_LAT_H_
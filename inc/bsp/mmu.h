@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    mmu.h
+ * @brief   Declaración del mapa plano de la MMU y del mantenimiento de caches
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef MMU_H_
+#define MMU_H_
+
+#include <stdint.h>
+
+#define MMU_ENTRADAS 4096U        // Tabla de primer nivel: una sección de 1 MB por entrada
+#define MMU_SECCION_DESP 20U
+
+// Descriptor de sección (formato corto)
+#define MMU_SECCION (2U << 0)
+#define MMU_SECCION_B (1U << 2)
+#define MMU_SECCION_C (1U << 3)
+#define MMU_SECCION_XN (1U << 4)
+#define MMU_SECCION_AP_RW (3U << 10) // Lectura y escritura en todos los modos
+#define MMU_SECCION_AP_KERNEL (1U << 10) // Solo los modos privilegiados
+#define MMU_SECCION_TEX(x) ((uint32_t)(x) << 12)
+#define MMU_SECCION_S (1U << 16)
+#define MMU_SECCION_NG (1U << 17) // No global: la entrada del TLB queda marcada con el ASID
+
+// Descriptor de tabla de segundo nivel y de página chica (4 KB)
+#define MMU_TABLA (1U << 0)
+#define MMU_L2_ENTRADAS 256U
+#define MMU_PAGINA_DESP 12U
+#define MMU_PAGINA_TAM (1U << MMU_PAGINA_DESP)
+#define MMU_PAGINA (2U << 0)
+#define MMU_PAGINA_XN (1U << 0)
+#define MMU_PAGINA_AP(x) ((uint32_t)(x) << 4)
+#define MMU_PAGINA_AP_MASK (3U << 4)
+#define MMU_PAGINA_NG (1U << 11)
+
+// Permisos de página (AP[2] = 0)
+#define MMU_AP_KERNEL 1U  // Solo los modos privilegiados
+#define MMU_AP_USR_RO 2U  // El modo usuario solo lee (y ejecuta)
+#define MMU_AP_USR_RW 3U  // Lectura y escritura en todos los modos
+
+// Con AISLAMIENTO la memoria es del kernel salvo lo que se abre explícitamente para las tareas
+#ifdef AISLAMIENTO
+#define MMU_SECCION_AP MMU_SECCION_AP_KERNEL
+#else
+#define MMU_SECCION_AP MMU_SECCION_AP_RW
+#endif
+
+#ifdef SMP
+#define MMU_COMPARTIDA MMU_SECCION_S // Coherencia entre las CPUs a través del SCU
+#else
+#define MMU_COMPARTIDA 0U
+#endif
+
+// Memoria normal write-back con write-allocate (TEX=001, C=1, B=1)
+#define MMU_NORMAL (MMU_SECCION | MMU_SECCION_TEX(1) | MMU_SECCION_C | MMU_SECCION_B | MMU_SECCION_AP | MMU_COMPARTIDA)
+// Dispositivo compartido, sin ejecución
+#define MMU_DISPOSITIVO (MMU_SECCION | MMU_SECCION_B | MMU_SECCION_XN | MMU_SECCION_AP)
+
+// Ventana de SDRAM de la realview: lo único que se mapea como memoria normal
+#define MMU_RAM_INICIO 0x70000000U
+#define MMU_RAM_FIN 0x80000000U
+
+// Bits de SCTLR
+#define SCTLR_M (1U << 0)  // MMU
+#define SCTLR_C (1U << 2)  // Cache de datos y unificadas
+#define SCTLR_Z (1U << 11) // Predicción de saltos
+#define SCTLR_I (1U << 12) // Cache de instrucciones
+
+#define ACTLR_SMP (1U << 6) // Cortex-A9: la CPU participa de la coherencia del SCU
+
+#define DACR_CLIENTE 0x55555555U // Todos los dominios como cliente: se respetan los permisos
+
+// ASID 0 queda reservado para el cambio de TTBR0; el kernel usa el 1 y los espacios de las tareas del 2 en adelante
+#define MMU_ASID_RESERVADO 0U
+#define MMU_ASID_KERNEL 1U
+
+// Tablas de segundo nivel para las MB que mezclan páginas del kernel y de las tareas (make AISLAMIENTO=1)
+#ifndef MMU_L2_CANT
+#define MMU_L2_CANT 16U
+#endif
+
+/*!
+ * @brief Espacio de direcciones de una o más tareas: su tabla de primer nivel y su ASID.
+ *        Todas las traducciones son VA = PA; los espacios solo difieren en los permisos de usuario.
+ */
+typedef struct mmu_espacio_s
+{
+    uint32_t *l1;   // Tabla de primer nivel, 16 KB alineada a 16 KB
+    uint32_t asid;  // Marca de las entradas no globales del TLB
+} mmu_espacio_t;
+
+/*!
+ * @brief Arma la tabla plana (VA = PA) y habilita MMU y caches en la CPU0.
+ *
+ * @return None
+ */
+void mmu_init(void);
+
+/*!
+ * @brief Invalida caches y TLB y habilita MMU y caches en la CPU local con la tabla ya armada.
+ *
+ * @return None
+ */
+void mmu_habilitar(void);
+
+/*!
+ * @brief Limpia toda la cache de datos por set/way hasta el punto de coherencia.
+ *        Se usa antes de despertar CPUs que todavía corren sin cache.
+ *
+ * @return None
+ */
+void cache_limpiar_todo(void);
+
+/*!
+ * @brief Limpia las líneas de datos de un rango para que un maestro de bus (DMA) lea memoria actualizada.
+ *
+ * @param[in] inicio Primera dirección del rango.
+ * @param[in] tam Tamaño en bytes.
+ * @return None
+ */
+void cache_limpiar_rango(const void *inicio, uint32_t tam);
+
+/*!
+ * @brief Cambia los permisos de usuario de un rango en la tabla del kernel. Vale para todos los espacios:
+ *        las páginas siguen siendo globales y sus entradas del TLB se comparten entre ASIDs.
+ *
+ * @param[in] inicio Primera dirección (se redondea a página).
+ * @param[in] fin Dirección siguiente a la última.
+ * @param[in] ap Permisos: MMU_AP_KERNEL, MMU_AP_USR_RO o MMU_AP_USR_RW.
+ * @param[in] xn 1 si el rango no se puede ejecutar.
+ * @return None
+ */
+void mmu_abrir_global(uint32_t inicio, uint32_t fin, uint32_t ap, uint32_t xn);
+
+/*!
+ * @brief Marca un rango como no global en la tabla del kernel. Hay que llamarla, antes de crear los espacios,
+ *        para todo rango que algún espacio abra: una entrada global del TLB valdría para todos los ASIDs.
+ *
+ * @param[in] inicio Primera dirección (se redondea a página).
+ * @param[in] fin Dirección siguiente a la última.
+ * @return None
+ */
+void mmu_marcar_privado(uint32_t inicio, uint32_t fin);
+
+/*!
+ * @brief Crea un espacio copiando la tabla del kernel: arranca sin nada propio abierto.
+ *
+ * @param[out] esp Espacio a inicializar.
+ * @param[in] l1 Tabla de primer nivel del espacio (16 KB alineada a 16 KB).
+ * @param[in] asid ASID del espacio, mayor que MMU_ASID_KERNEL.
+ * @return None
+ */
+void mmu_espacio_crear(mmu_espacio_t *esp, uint32_t *l1, uint32_t asid);
+
+/*!
+ * @brief Da acceso de usuario a un rango marcado como privado, solo en este espacio.
+ *
+ * @param[in] esp Espacio.
+ * @param[in] inicio Primera dirección (se redondea a página).
+ * @param[in] fin Dirección siguiente a la última.
+ * @param[in] ap MMU_AP_USR_RO o MMU_AP_USR_RW.
+ * @return None
+ */
+void mmu_espacio_abrir(mmu_espacio_t *esp, uint32_t inicio, uint32_t fin, uint32_t ap);
+
+/*!
+ * @brief Limpia las tablas de la cache (los recorridos no pasan por la cache) e invalida el TLB local.
+ *        Se llama una vez, con todos los espacios armados y antes de arrancar las otras CPUs.
+ *
+ * @return None
+ */
+void mmu_tablas_publicar(void);
+
+/*!
+ * @brief Pasa la CPU local a otro espacio cambiando TTBR0 y el ASID, sin invalidar el TLB.
+ *
+ * @param[in] esp Espacio entrante; NULL es el del kernel.
+ * @return None
+ */
+void mmu_espacio_activar(const mmu_espacio_t *esp);
+
+/*!
+ * @brief Recorre las tablas de un espacio y dice si el modo usuario puede acceder a todo un rango.
+ *        No depende del espacio activo: sirve para validar punteros de una tarea desde el tick.
+ *
+ * @param[in] esp Espacio de la tarea.
+ * @param[in] inicio Primera dirección.
+ * @param[in] largo Bytes del rango; 0 siempre es válido.
+ * @param[in] escribir 0 si alcanza con leer, 1 si hace falta escribir.
+ * @return 1 si todas las páginas del rango son accesibles, 0 si no o si el rango da la vuelta.
+ */
+uint32_t mmu_espacio_accesible(const mmu_espacio_t *esp, uint32_t inicio, uint32_t largo, uint32_t escribir);
+
+#endif // MMU_H_
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    mpcore.h
+ * @brief   Definiciones de los periféricos privados del Cortex-A9 MPCore (realview-pbx-a9)
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef MPCORE_H_
+#define MPCORE_H_
+
+#include <stdint.h>
+
+#define MPCORE_PERIPH_BASE 0x1F000000U              // PERIPHBASE de la realview-pbx-a9
+#define MPCORE_SCU_ADDR (MPCORE_PERIPH_BASE + 0x0000U)
+#define MPCORE_GICC_ADDR (MPCORE_PERIPH_BASE + 0x0100U)
+#define MPCORE_PTIMER_ADDR (MPCORE_PERIPH_BASE + 0x0600U)
+#define MPCORE_GICD_ADDR (MPCORE_PERIPH_BASE + 0x1000U)
+
+// Interfaz de CPU y distribuidor del GIC que usa el kernel
+#ifdef SMP
+#define GICC_ADDR MPCORE_GICC_ADDR
+#define GICD_ADDR MPCORE_GICD_ADDR
+#else
+#define GICC_ADDR GICC0_ADDR
+#define GICD_ADDR GICD0_ADDR
+#endif
+#define GICD_ISENABLER(n) (*(volatile uint32_t *)(GICD_ADDR + 0x100U + 4U * (n)))
+#define GICD_ITARGETSR(n) (*(volatile uint8_t *)(GICD_ADDR + 0x800U + (n)))
+
+// Registros del distribuidor del GIC usados por el kernel SMP
+#define MPCORE_GICD_CTLR (*(volatile uint32_t *)(MPCORE_GICD_ADDR + 0x000U))
+#define MPCORE_GICD_ISENABLER(n) (*(volatile uint32_t *)(MPCORE_GICD_ADDR + 0x100U + 4U * (n)))
+#define MPCORE_GICD_SGIR (*(volatile uint32_t *)(MPCORE_GICD_ADDR + 0xF00U))
+
+#define GICD_SGIR_TARGET_LIST (0U << 24)   // Envía el SGI a las CPUs de CPUTargetList
+#define GICD_SGIR_OTROS (1U << 24)         // Envía el SGI a todas las CPUs menos a la que lo genera
+
+// Registros de sistema de la realview usados por el bootloader de QEMU para liberar las CPUs secundarias
+#define REALVIEW_SYS_FLAGSSET (*(volatile uint32_t *)0x10000030U)
+#define REALVIEW_SYS_FLAGSCLR (*(volatile uint32_t *)0x10000034U)
+
+// Interrupciones privadas de cada CPU
+#define GIC_SGI_WAKEUP 0      // Despierta a las CPUs secundarias del holding pen
+#define GIC_SGI_RESCHED 1     // Pide a otra CPU que replanifique
+#define GIC_SOURCE_PTIMER 29  // Timer privado (PPI)
+
+#define PTIMER_CTRL_ENABLE (1U << 0)
+#define PTIMER_CTRL_AUTO_RELOAD (1U << 1)
+#define PTIMER_CTRL_IRQ_ENABLE (1U << 2)
+#define PTIMER_LOAD 100000U   // Período del tick de cada CPU en ciclos de PERIPHCLK
+
+typedef struct
+{
+    volatile uint32_t Load;
+    volatile uint32_t Counter;
+    volatile uint32_t Control;
+    volatile uint32_t IntStatus;
+} _ptimer_t;
+
+/*!
+ * @brief Habilita la SCU y el distribuidor del GIC. Solo la llama la CPU0.
+ *
+ * @return None
+ */
+void mpcore_init(void);
+
+/*!
+ * @brief Habilita la interfaz de CPU del GIC y el timer privado de la CPU que la llama.
+ *
+ * @return None
+ */
+void mpcore_cpu_init(void);
+
+/*!
+ * @brief Habilita una fuente compartida en el distribuidor del GIC y la dirige a la CPU0.
+ *        Sin MPCore ITARGETSR es de solo lectura y la escritura no tiene efecto.
+ *
+ * @param[in] fuente Número de interrupción (32 en adelante).
+ * @return None
+ */
+void gic_habilitar_fuente(uint32_t fuente);
+
+/*!
+ * @brief Envía un SGI a las CPUs indicadas.
+ *
+ * @param[in] sgi Número de SGI (0 a 15).
+ * @param[in] filtro GICD_SGIR_TARGET_LIST o GICD_SGIR_OTROS.
+ * @param[in] cpus Máscara de CPUs destino (solo con GICD_SGIR_TARGET_LIST).
+ * @return None
+ */
+void mpcore_send_sgi(uint32_t sgi, uint32_t filtro, uint32_t cpus);
+
+/*!
+ * @brief Manejador del timer privado: limpia la interrupción y ejecuta el tick.
+ *
+ * @param[in] sp_irq Stack pointer con el contexto guardado.
+ * @return Stack pointer del contexto a restaurar.
+ */
+uint32_t *PTIMER_IRQHandler(uint32_t *sp_irq);
+
+#endif // MPCORE_H_
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    pl080.h
+ * @brief   Declaración del driver del controlador DMA PL080 y del canal de transmisión de la UART0
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef PL080_H_
+#define PL080_H_
+
+#include <stdint.h>
+
+#define PL080_ADDR 0x10030000U
+#define GIC_SOURCE_DMAC 56 // SPI 24 de la realview
+
+// Bits del registro de configuración global
+#define PL080_CONFIG_E (1U << 0)
+
+// Bits del registro de control de canal
+#define PL080_CTRL_TAM_MAX 0xFFFU
+#define PL080_CTRL_SBSIZE(n) ((uint32_t)(n) << 12)
+#define PL080_CTRL_DBSIZE(n) ((uint32_t)(n) << 15)
+#define PL080_CTRL_SWIDTH_8 (0U << 18)
+#define PL080_CTRL_DWIDTH_8 (0U << 21)
+#define PL080_CTRL_SI (1U << 26)
+#define PL080_CTRL_DI (1U << 27)
+#define PL080_CTRL_I (1U << 31)
+#define PL080_BURST_4 1U
+
+// Bits del registro de configuración de canal
+#define PL080_CCFG_E (1U << 0)
+#define PL080_CCFG_DEST_PERIF(n) ((uint32_t)(n) << 6)
+#define PL080_CCFG_FLUJO_M2M (0U << 11)
+#define PL080_CCFG_FLUJO_M2P (1U << 11)
+#define PL080_CCFG_IE (1U << 14)
+#define PL080_CCFG_ITC (1U << 15)
+
+#define PL011_DMACR(base) (*(volatile uint32_t *)((base) + 0x048U))
+#define PL011_DMACR_TXDMAE (1U << 1)
+
+// Línea de pedido DMA de transmisión de la UART0; depende del cableado de la placa
+#ifndef DMA_UART_PEDIDO_TX
+#define DMA_UART_PEDIDO_TX 15U
+#endif
+
+#define DMA_UART_CANAL 0U
+#define DMA_UART_BUF 4096U // Buffer circular de salida; potencia de 2
+#define DMA_UART_CANT_LLI 4U
+
+typedef struct
+{
+    volatile uint32_t SrcAddr;
+    volatile uint32_t DestAddr;
+    volatile uint32_t LLI;
+    volatile uint32_t Control;
+    volatile uint32_t Configuration;
+    volatile uint32_t reservado[3];
+} _pl080_canal_t;
+
+typedef struct
+{
+    volatile uint32_t IntStatus;
+    volatile uint32_t IntTCStatus;
+    volatile uint32_t IntTCClear;
+    volatile uint32_t IntErrorStatus;
+    volatile uint32_t IntErrClr;
+    volatile uint32_t RawIntTCStatus;
+    volatile uint32_t RawIntErrorStatus;
+    volatile uint32_t EnbldChns;
+    volatile uint32_t SoftBReq;
+    volatile uint32_t SoftSReq;
+    volatile uint32_t SoftLBReq;
+    volatile uint32_t SoftLSReq;
+    volatile uint32_t Configuration;
+    volatile uint32_t Sync;
+    volatile uint32_t reservado[50];
+    _pl080_canal_t canal[8];
+} _pl080_t;
+
+/*!
+ * @brief Descriptor de scatter-gather: el controlador lo carga en los registros del canal.
+ */
+typedef struct
+{
+    uint32_t src;
+    uint32_t dst;
+    uint32_t lli;
+    uint32_t ctrl;
+} pl080_lli_t;
+
+/*!
+ * @brief Habilita el controlador, la UART0 como destino de DMA y la interrupción de fin de transferencia.
+ *
+ * @return None
+ */
+void dma_uart_init(void);
+
+/*!
+ * @brief Encola un texto para transmitir por DMA. Solo copia al buffer circular: no espera a la UART.
+ *        Si el buffer está lleno espera a que termine la transferencia en curso.
+ *
+ * @param[in] buf Texto terminado en '\0'.
+ * @return Cantidad de bytes encolados.
+ */
+int dma_uart_escribir(const char *buf);
+
+/*!
+ * @brief Igual que dma_uart_escribir pero con largo explícito: el texto puede tener '\0' y no hace falta terminarlo.
+ *
+ * @param[in] buf Datos a transmitir.
+ * @param[in] len Cantidad de bytes.
+ * @return Cantidad de bytes encolados, o -1 si buf es NULL.
+ */
+int dma_uart_escribir_len(const char *buf, uint32_t len);
+
+/*!
+ * @brief Espera con IRQs deshabilitadas a que se transmita todo lo encolado.
+ *
+ * @return None
+ */
+void dma_uart_vaciar(void);
+
+/*!
+ * @brief Mitad superior de la interrupción del PL080: la reconoce y marca SOFTIRQ_DMA.
+ *
+ * @return None
+ */
+void DMAC_IRQHandler(void);
+
+/*!
+ * @brief Mitad inferior: libera lo transmitido y arranca el próximo lote.
+ *
+ * @return None
+ */
+void dma_uart_softirq(void);
+
+#endif // PL080_H_
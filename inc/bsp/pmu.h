@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    pmu.h
+ * @brief   Acceso a la unidad de monitoreo de rendimiento (PMU) del Cortex-A
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef PMU_H_
+#define PMU_H_
+
+#include <stdint.h>
+
+#define PMU_PMCR_E (1U << 0)         // Habilita todos los contadores
+#define PMU_PMCR_P (1U << 1)         // Reinicia los contadores de eventos
+#define PMU_PMCR_C (1U << 2)         // Reinicia el contador de ciclos
+#define PMU_CNTEN_CCNT (1U << 31)    // Bit del contador de ciclos en PMCNTENSET
+
+#define PMU_CANT_EVENTOS 4U          // Contadores de eventos del Cortex-A8 y del Cortex-A9 (tiene 6)
+
+// Eventos comunes de ARMv7
+#define PMU_EVT_L1I_REFILL 0x01U     // Fallo en la cache de instrucciones
+#define PMU_EVT_L1D_REFILL 0x03U     // Fallo en la cache de datos
+#define PMU_EVT_L1D_ACCESS 0x04U     // Acceso a la cache de datos
+#ifdef CPU_A9
+#define PMU_EVT_INSTR 0x68U          // El Cortex-A9 no implementa 0x08: instrucciones que salen del renombrado
+#else
+#define PMU_EVT_INSTR 0x08U          // Instrucciones ejecutadas
+#endif
+
+/*!
+ * @brief Lee el contador de ciclos (PMCCNTR) en la variable indicada.
+ */
+#define PMU_READ_CCNT(x) __asm__ volatile("MRC p15, 0, %0, c9, c13, 0" : "=r"(x))
+
+/*!
+ * @brief Habilita el contador de ciclos y lo pone en cero.
+ *
+ * @return None
+ */
+void pmu_init(void);
+
+/*!
+ * @brief Asigna un evento a un contador de la CPU local y lo habilita.
+ *
+ * @param[in] contador Contador, de 0 a PMU_CANT_EVENTOS - 1.
+ * @param[in] evento Número de evento (PMU_EVT_*).
+ * @return None
+ */
+void pmu_evento_config(uint32_t contador, uint32_t evento);
+
+/*!
+ * @brief Lee un contador de eventos de la CPU local.
+ *
+ * @param[in] contador Contador, de 0 a PMU_CANT_EVENTOS - 1.
+ * @return Cuenta actual del contador.
+ */
+uint32_t pmu_evento_leer(uint32_t contador);
+
+#endif // PMU_H_
@@ -32,6 +32,24 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdarg.h>
+
+// Sección de las funciones del kernel. En RELEASE cada función queda en su propia .text.<nombre>
+// (-ffunction-sections) para que el linker descarte las que no se usan.
+#ifdef RELEASE
+#define SECCION_TEXT
+#else
+#define SECCION_TEXT __attribute__((section(".text")))
+#endif
+
+// Layout consciente de la cache (make CACHE_COLOR=1): las estructuras calientes del kernel
+// arrancan en una línea propia (64 bytes en el Cortex-A8, cubre las de 32 del Cortex-A9)
+#define CACHE_LINEA 64
+#ifdef CACHE_COLOR
+#define ALINEADO_CACHE __attribute__((aligned(CACHE_LINEA)))
+#else
+#define ALINEADO_CACHE
+#endif
+
 #include "board/gic.h"
 #include "board/timer.h"
 #include "board/uart.h"
@@ -39,9 +57,34 @@
 #include "utils/low_level_cpu_access.h"
 #include "irq/interrupciones.h"
 #include "bsp/board_init.h"
+#include "bsp/pmu.h"
+#include "bsp/boot_prof.h"
+#include "bsp/mpcore.h"
+#include "bsp/irq_lat.h"
+#include "bsp/pl080.h"
+#include "bsp/bench.h"
+#include "bsp/mmu.h"
+#include "bsp/cache_bench.h"
 #include "kernel/scheduler.h"
 #include "kernel/syscall.h"
+#include "kernel/kprint.h"
+#include "kernel/critical.h"
+#include "kernel/kmem.h"
+#include "kernel/stack_monitor.h"
+#include "kernel/clock.h"
+#include "kernel/rt.h"
+#include "kernel/uart_rx.h"
+#include "kernel/consola.h"
+#include "kernel/bitacora.h"
+#include "kernel/softirq.h"
+#include "kernel/workqueue.h"
+#include "kernel/stress.h"
+#include "kernel/anillos.h"
+#include "kernel/espacios.h"
 #include "user/syscall.h"
+#include "user/anillo.h"
+#include "user/heap.h"
+#include "user/fibra.h"
 #include "tasks/tasks.h"
 
 #define HALT_CPU __asm__("WFI")
@@ -51,4 +51,22 @@ uint32_t *C_IRQ_handler(uint32_t *sp_irq);
  */
 uint32_t *TIMER0_IRQHandler(uint32_t *sp_irq);
 
+/*!
+ * @brief Tick del scheduler: guarda el contexto actual, replanifica y carga el siguiente.
+ *        Lo llaman TIMER0 (un solo core) y el timer privado de cada CPU (SMP).
+ *
+ * @param[in] sp_irq Stack pointer con el contexto guardado por irq_handler.
+ * @return	  Devuelve el stack pointer del contexto a restaurar.
+ */
+uint32_t *tick_handler(uint32_t *sp_irq);
+
+/*!
+ * @brief Como tick_handler pero sin tick: para la SGI de replanificación, que no debe avanzar
+ *        el reloj ni la contabilidad de ticks.
+ *
+ * @param[in] sp_irq Stack pointer con el contexto guardado por irq_handler.
+ * @return	  Devuelve el stack pointer del contexto a restaurar.
+ */
+uint32_t *resched_handler(uint32_t *sp_irq);
+
 #endif /* INTERRUPCIONES_H_ */
\ No newline at end of file
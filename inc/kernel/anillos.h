@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    anillos.h
+ * @brief   Anillos de envío y de completado compartidos entre una tarea y el kernel
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef ANILLOS_H_
+#define ANILLOS_H_
+
+#include <stdint.h>
+
+// Entradas del anillo de envío: las elige la tarea al registrarlo, potencia de 2 hasta ANILLO_SQ_MAX.
+// El de completado es el doble para absorber los timers.
+#define ANILLO_SQ_MAX 1024U
+#define ANILLO_CQ_CANT(sq_cant) (2U * (sq_cant))
+
+#define ANILLO_TIMERS 4U              // Timers armados a la vez por tarea
+#define ANILLO_PRESUPUESTO_TICK 16U   // Envíos que se procesan por tarea en cada tick
+#define ANILLO_PRESUPUESTO_IDLE 64U   // Envíos que se procesan por tarea en cada vuelta de la idle
+
+// Qué hace anillo_drenar con ANILLO_OP_WRITE
+#define ANILLO_ESCRIBIR_NO 0U  // Se detiene: la softirq del reloj no usa la UART por polling
+#define ANILLO_ESCRIBIR_SI 1U  // Escribe sin el lock; la idle ya corre con las IRQ habilitadas
+#define ANILLO_ESCRIBIR_SVC 2U // Desde anillo_enter: con SVC_EXPROPIABLE además habilita las IRQ mientras escribe
+
+typedef enum
+{
+    ANILLO_OP_NOP = 0,   // Se completa enseguida con res = 0
+    ANILLO_OP_WRITE,     // arg0: cadena terminada en '\0'. res: bytes escritos
+    ANILLO_OP_TIMER,     // arg0: ticks. Se completa cuando vencen, con res = 0
+    ANILLO_OP_CLOCK,     // arg0: reloj, arg1: timespec_t *. res: como SYS_CLOCK_GETTIME
+    ANILLO_OP_CANT,
+} anillo_op_t;
+
+/*!
+ * @brief Pedido en el anillo de envío. user_data vuelve tal cual en la completion.
+ */
+typedef struct
+{
+    uint32_t op;
+    uint32_t arg0;
+    uint32_t arg1;
+    uint32_t user_data;
+} anillo_sqe_t;
+
+typedef struct
+{
+    uint32_t user_data;
+    int32_t res; // -1 si el pedido es inválido o no hay lugar para otro timer
+} anillo_cqe_t;
+
+/*!
+ * @brief Memoria compartida. Los índices corren libres y se enmascaran al indexar:
+ *        cada lado escribe solo su índice (la tarea sq_cola y cq_cabeza, el kernel sq_cabeza y cq_cola).
+ *        Las entradas siguen a la cabecera en el mismo bloque: sq_cant envíos y el doble de completions.
+ */
+typedef struct
+{
+    volatile uint32_t sq_cabeza;
+    volatile uint32_t sq_cola;
+    volatile uint32_t cq_cabeza;
+    volatile uint32_t cq_cola;
+    uint32_t sq_local; // Cola todavía no publicada; la usa solo la tarea
+    uint32_t sq_cant;  // Copia de la tarea; el kernel usa la que guardó al registrarlo
+} anillo_t;
+
+#define ANILLO_SQ(a) ((anillo_sqe_t *)((anillo_t *)(a) + 1))
+#define ANILLO_CQ(a, sq_cant) ((anillo_cqe_t *)(ANILLO_SQ(a) + (sq_cant)))
+// Bytes del bloque de un anillo con sq_cant envíos
+#define ANILLO_TAM(sq_cant) \
+    (sizeof(anillo_t) + (sq_cant) * sizeof(anillo_sqe_t) + ANILLO_CQ_CANT(sq_cant) * sizeof(anillo_cqe_t))
+
+typedef struct
+{
+    uint32_t vence; // Tick de anillos_tick
+    uint32_t user_data;
+    uint8_t activo;
+} anillo_timer_t;
+
+typedef struct
+{
+    anillo_t *anillo; // NULL si la tarea no registró un anillo
+    anillo_sqe_t *sq; // Entradas y tamaño tomados al registrarlo: la tarea no los puede cambiar después
+    anillo_cqe_t *cq;
+    uint32_t sq_cant;
+    spinlock_t lock;
+    uint8_t esperando;   // Bloqueada en SYS_RING_ENTER hasta que haya completions
+    uint8_t escribiendo; // Un drenaje soltó el lock para escribir: los demás no tocan el anillo
+    anillo_timer_t timers[ANILLO_TIMERS];
+} anillo_tarea_t;
+
+/*!
+ * @brief Crea la cache de kmem del estado por tarea de los anillos. Se llama después de kmem_init.
+ *
+ * @return None
+ */
+void anillos_init(void);
+
+/*!
+ * @brief Implementación de SYS_RING_SETUP: asocia el anillo a la tarea actual.
+ *
+ * @param[in] anillo Anillos de la tarea, en un bloque de ANILLO_TAM(sq_cant) bytes.
+ * @param[in] sq_cant Entradas del anillo de envío; potencia de 2 hasta ANILLO_SQ_MAX.
+ * @return 0 o -1 en error (incluido no tener memoria para el estado de la tarea).
+ */
+int sys_anillo_registrar(anillo_t *anillo, uint32_t sq_cant);
+
+/*!
+ * @brief Implementación de SYS_RING_ENTER: procesa todos los envíos publicados de la tarea actual.
+ *
+ * @param[in] esperar Distinto de 0 para dormir a la tarea si no quedó ninguna completion para leer.
+ * @param[out] bloqueada 1 si la tarea quedó bloqueada; después hay que llamar a scheduler_yield.
+ * @return Cantidad de envíos procesados o -1 si la tarea no tiene anillo.
+ */
+int sys_anillo_enter(uint32_t esperar, uint32_t *bloqueada);
+
+/*!
+ * @brief Vence los timers y procesa un lote de envíos de cada tarea. La llama la CPU0 en cada tick.
+ *        Las escrituras no se procesan acá: quedan para anillo_enter o la tarea idle.
+ *
+ * @return None
+ */
+void anillos_tick(void);
+
+/*!
+ * @brief Procesa un lote de envíos de cada tarea aprovechando el tiempo ocioso.
+ *
+ * @return None
+ */
+void anillos_idle(void);
+
+#endif // ANILLOS_H_
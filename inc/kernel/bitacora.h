@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    bitacora.h
+ * @brief   Declaración de la bitácora binaria: el formato queda en el ELF y por la UART solo viajan los argumentos
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef BITACORA_H_
+#define BITACORA_H_
+
+#include <stdint.h>
+#include <stdarg.h>
+
+// Niveles: con make BITACORA=<nivel> se compilan los registros de ese nivel o más graves.
+// Sin BITACORA no se compila ninguno y sus argumentos no se evalúan.
+#define BITACORA_NIVEL_ERROR 1U
+#define BITACORA_NIVEL_AVISO 2U
+#define BITACORA_NIVEL_INFO 3U
+#define BITACORA_NIVEL_DEPURAR 4U
+#ifdef BITACORA
+#define BITACORA_NIVEL BITACORA
+#else
+#define BITACORA_NIVEL 0
+#endif
+
+#ifndef BITACORA_UART
+#define BITACORA_UART 3U // Los registros salen por su propia UART: lst/bitacora.bin en QEMU
+#endif
+
+// Registro, en palabras little-endian:
+//   [0] BITACORA_SINCRO | (nivel << 12) | (cantidad de argumentos << 8) | (índice del formato << 16)
+//   [1] tiempo en us (clock_ciclos)
+//   [2..] argumentos, de 32 bits cada uno
+// El índice es la dirección del formato en .bitacora_fmt, que el linker no carga y ubica en 0.
+#define BITACORA_SINCRO 0xB1U
+#define BITACORA_MAX_ARGS 8U
+#define BITACORA_REG_PALABRAS (2U + BITACORA_MAX_ARGS)
+#define BITACORA_CABECERA(nivel, fmt, nargs) \
+    (BITACORA_SINCRO | ((uint32_t)(nivel) << 12) | ((uint32_t)(nargs) << 8) | ((uint32_t)(fmt) << 16))
+#define BITACORA_NARGS(cabecera) (((cabecera) >> 8) & 0xFU)
+
+// Cuenta los argumentos; a partir del noveno no compila
+#define BITACORA_CONTAR_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, N, ...) N
+#define BITACORA_CONTAR(...)                                                                           \
+    BITACORA_CONTAR_(0, ##__VA_ARGS__, bitacora_demasiados_argumentos, bitacora_demasiados_argumentos, \
+                     bitacora_demasiados_argumentos, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+
+// Los argumentos se pasan como palabras de 32 bits: enteros, caracteres y punteros.
+// %s solo sirve para cadenas constantes de la imagen, que la herramienta lee del ELF.
+#define BITACORA_REGISTRAR_(funcion, nivel, fmt, ...)                                               \
+    do                                                                                              \
+    {                                                                                               \
+        static const char bitacora_fmt_[] __attribute__((section(".bitacora_fmt"))) = fmt;        \
+        funcion(BITACORA_CABECERA(nivel, bitacora_fmt_, BITACORA_CONTAR(__VA_ARGS__)), ##__VA_ARGS__); \
+    } while (0)
+
+// BITACORA_* para las tareas (entran con SYS_LOG), KBITACORA_* para el kernel
+#if BITACORA_NIVEL >= BITACORA_NIVEL_ERROR
+#define BITACORA_ERROR(fmt, ...) BITACORA_REGISTRAR_(my_bitacora, BITACORA_NIVEL_ERROR, fmt, ##__VA_ARGS__)
+#define KBITACORA_ERROR(fmt, ...) BITACORA_REGISTRAR_(kbitacora, BITACORA_NIVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define BITACORA_ERROR(fmt, ...) do { } while (0)
+#define KBITACORA_ERROR(fmt, ...) do { } while (0)
+#endif
+#if BITACORA_NIVEL >= BITACORA_NIVEL_AVISO
+#define BITACORA_AVISO(fmt, ...) BITACORA_REGISTRAR_(my_bitacora, BITACORA_NIVEL_AVISO, fmt, ##__VA_ARGS__)
+#define KBITACORA_AVISO(fmt, ...) BITACORA_REGISTRAR_(kbitacora, BITACORA_NIVEL_AVISO, fmt, ##__VA_ARGS__)
+#else
+#define BITACORA_AVISO(fmt, ...) do { } while (0)
+#define KBITACORA_AVISO(fmt, ...) do { } while (0)
+#endif
+#if BITACORA_NIVEL >= BITACORA_NIVEL_INFO
+#define BITACORA_INFO(fmt, ...) BITACORA_REGISTRAR_(my_bitacora, BITACORA_NIVEL_INFO, fmt, ##__VA_ARGS__)
+#define KBITACORA_INFO(fmt, ...) BITACORA_REGISTRAR_(kbitacora, BITACORA_NIVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define BITACORA_INFO(fmt, ...) do { } while (0)
+#define KBITACORA_INFO(fmt, ...) do { } while (0)
+#endif
+#if BITACORA_NIVEL >= BITACORA_NIVEL_DEPURAR
+#define BITACORA_DEPURAR(fmt, ...) BITACORA_REGISTRAR_(my_bitacora, BITACORA_NIVEL_DEPURAR, fmt, ##__VA_ARGS__)
+#define KBITACORA_DEPURAR(fmt, ...) BITACORA_REGISTRAR_(kbitacora, BITACORA_NIVEL_DEPURAR, fmt, ##__VA_ARGS__)
+#else
+#define BITACORA_DEPURAR(fmt, ...) do { } while (0)
+#define KBITACORA_DEPURAR(fmt, ...) do { } while (0)
+#endif
+
+/*!
+ * @brief Arma un registro en un buffer. No toca hardware: la usan el kernel y las tareas.
+ *
+ * @param[out] reg Buffer de BITACORA_REG_PALABRAS palabras.
+ * @param[in] cabecera Cabecera armada con BITACORA_CABECERA.
+ * @param[in] tiempo Tiempo del registro en us.
+ * @param[in] args Argumentos, tantos como indica la cabecera.
+ * @return Largo del registro en bytes.
+ */
+uint32_t bitacora_armar(uint32_t *reg, uint32_t cabecera, uint32_t tiempo, va_list args);
+
+/*!
+ * @brief Prepara la UART de la bitácora. Con CONSOLA ya la inicializa consola_init.
+ *
+ * @return None
+ */
+void bitacora_init(void);
+
+/*!
+ * @brief Registra desde el kernel (IRQ, softirq o llamada al sistema). Usar con los KBITACORA_*.
+ *
+ * @param[in] cabecera Cabecera armada con BITACORA_CABECERA.
+ * @return None
+ */
+void kbitacora(uint32_t cabecera, ...);
+
+/*!
+ * @brief Implementación de SYS_LOG: valida un registro armado por una tarea y lo envía.
+ *
+ * @param[in] reg Registro.
+ * @param[in] len Largo en bytes.
+ * @return Bytes enviados o -1 si el registro no es válido.
+ */
+int sys_bitacora(const uint32_t *reg, uint32_t len);
+
+#endif // BITACORA_H_
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    clock.h
+ * @brief   Declaración de la fuente de tiempo monotónica de alta resolución
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#include <stdint.h>
+
+#define CLOCK_TIMER_ADDR TIMER2_ADDR // SP804 libre usado como fuente de tiempo (canal 1)
+#define CLOCK_FREQ_HZ 1000000U       // TIMCLK de los SP804 de la realview
+
+#define NSEC_POR_SEG 1000000000U
+
+// ns = (ciclos * CLOCK_MULT) >> CLOCK_SHIFT. La división se resuelve en tiempo de compilación.
+#define CLOCK_SHIFT 20
+#define CLOCK_MULT ((uint32_t)(((uint64_t)NSEC_POR_SEG << CLOCK_SHIFT) / CLOCK_FREQ_HZ))
+
+// Bits del registro de control del SP804
+#define SP804_CTRL_ONESHOT (1U << 0)
+#define SP804_CTRL_32BIT (1U << 1)
+#define SP804_CTRL_INTEN (1U << 5)
+#define SP804_CTRL_PERIODIC (1U << 6)
+#define SP804_CTRL_ENABLE (1U << 7)
+
+#define CLOCK_MONOTONIC 1
+
+typedef struct
+{
+    uint32_t tv_sec;
+    uint32_t tv_nsec;
+} timespec_t;
+
+/*!
+ * @brief Página compartida con las tareas para leer la hora sin SVC.
+ *        El kernel la actualiza en cada tick protegida por un contador de secuencia:
+ *        impar mientras se escribe, par cuando es consistente.
+ */
+typedef struct
+{
+    volatile uint32_t seq;
+    volatile uint32_t ciclos_base; // Ciclos (ascendentes) en la última actualización
+    volatile uint32_t ciclos_hi;   // Parte alta del contador extendido a 64 bits
+    volatile uint32_t seg_base;    // Tiempo monotónico en la última actualización
+    volatile uint32_t nseg_base;
+    volatile uint64_t ns_base;
+    uint32_t mult;
+    uint32_t shift;
+    uint32_t timer_addr;
+} clock_page_t;
+
+extern clock_page_t clock_page;
+
+/*!
+ * @brief Lectura del tiempo monotónico desde la página compartida: reintenta mientras el kernel la
+ *        actualiza (seq impar o distinto) y suma los ciclos desde el último tick con mult y shift.
+ *        La usan clock_page_leer en el kernel y my_clock_gettime_rapido en las tareas.
+ *
+ * @param[out] ts Tiempo monotónico.
+ * @return None
+ */
+static inline __attribute__((always_inline)) void clock_page_leer_inline(timespec_t *ts)
+{
+    uint32_t seq;
+    uint32_t seg;
+    uint32_t nseg;
+    uint32_t delta;
+    _timer_t *TIMER;
+
+    do
+    {
+        seq = clock_page.seq;
+        __asm__ volatile("DMB" : : : "memory");
+        TIMER = (_timer_t *)clock_page.timer_addr;
+        delta = (0xFFFFFFFFU - TIMER->Timer1Value) - clock_page.ciclos_base;
+        seg = clock_page.seg_base;
+        nseg = clock_page.nseg_base;
+        __asm__ volatile("DMB" : : : "memory");
+    } while ((seq & 1U) != 0 || seq != clock_page.seq);
+
+    // Entre ticks el delta es chico: con sumar y normalizar alcanza, sin dividir
+    nseg += (uint32_t)(((uint64_t)delta * clock_page.mult) >> clock_page.shift);
+    while (nseg >= NSEC_POR_SEG)
+    {
+        nseg -= NSEC_POR_SEG;
+        seg++;
+    }
+    ts->tv_sec = seg;
+    ts->tv_nsec = nseg;
+}
+
+/*!
+ * @brief Arranca el SP804 en modo libre de 32 bits e inicializa la página compartida.
+ *
+ * @return None
+ */
+void clock_init(void);
+
+/*!
+ * @brief Avanza la base de tiempo. Se llama desde el tick; como el período del tick es mucho
+ *        menor que la vuelta del contador de 32 bits, acá también se detecta el desborde.
+ *
+ * @return None
+ */
+void clock_tick(void);
+
+/*!
+ * @brief Lee el contador libre (ascendente) de 32 bits.
+ *
+ * @return Ciclos de CLOCK_FREQ_HZ.
+ */
+uint32_t clock_ciclos(void);
+
+/*!
+ * @brief Devuelve el contador extendido a 64 bits.
+ *
+ * @return Ciclos de CLOCK_FREQ_HZ desde clock_init.
+ */
+uint64_t clock_ciclos64(void);
+
+/*!
+ * @brief Devuelve el tiempo monotónico en nanosegundos.
+ *
+ * @return Nanosegundos desde clock_init.
+ */
+uint64_t clock_ns(void);
+
+/*!
+ * @brief Lee el tiempo monotónico desde la página compartida.
+ *
+ * @param[out] ts Tiempo monotónico.
+ * @return None
+ */
+void clock_page_leer(timespec_t *ts);
+
+/*!
+ * @brief Implementación de la llamada al sistema clock_gettime.
+ *
+ * @param[in] clk_id Reloj pedido (solo CLOCK_MONOTONIC).
+ * @param[out] ts Tiempo monotónico.
+ * @return 0 o -1 en error.
+ */
+int sys_clock_gettime(uint32_t clk_id, timespec_t *ts);
+
+#endif // CLOCK_H_
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    consola.h
+ * @brief   Declaración de la consola multiplexada: un canal de salida por UART (make CONSOLA=1)
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef CONSOLA_H_
+#define CONSOLA_H_
+
+#include <stdint.h>
+
+#define CONSOLA_CANALES 4U    // UART0 a UART3 de la realview
+#define CONSOLA_TX_BUF 1024U  // Cola de transmisión de cada canal; potencia de 2
+
+// Bits del PL011 para la transmisión (los de recepción están en uart_rx.h)
+#define PL011_FR_TXFF (1U << 5)
+#define PL011_IFLS_TX_MITAD 2U // Interrumpe con el FIFO de transmisión a la mitad
+#define PL011_INT_TX (1U << 5)
+
+typedef struct
+{
+    uint32_t bytes;
+    uint32_t esperas;        // Escrituras que encontraron la cola llena y vaciaron en el lugar
+    uint32_t interrupciones;
+} consola_stats_t;
+
+typedef struct
+{
+    uint32_t base;                 // Dirección del PL011
+    volatile uint32_t inicio;      // Próximo byte a pasar al FIFO
+    volatile uint32_t fin;         // Próximo lugar libre
+    spinlock_t lock;
+    consola_stats_t stats;
+    uint8_t buf[CONSOLA_TX_BUF];
+} ALINEADO_CACHE consola_canal_t;
+
+/*!
+ * @brief Inicializa las cuatro UART con una cola de transmisión e interrupción propias cada una,
+ *        y asigna el canal inicial de cada tarea. Reemplaza a __uart_init(0) en board_init.
+ *
+ * @return None
+ */
+void consola_init(void);
+
+/*!
+ * @brief Encola un buffer en un canal y arranca la transmisión. Solo espera si la cola está llena.
+ *
+ * @param[in] canal Canal, de 0 a CONSOLA_CANALES - 1.
+ * @param[in] buf Datos a escribir.
+ * @param[in] len Cantidad de bytes.
+ * @return Cantidad de bytes encolados o -1 en error.
+ */
+int consola_escribir(uint32_t canal, const char *buf, uint32_t len);
+
+/*!
+ * @brief Escribe en el canal de la tarea actual (SYS_WRITE y SYS_WRITE_LEN).
+ *
+ * @param[in] buf Datos a escribir.
+ * @param[in] len Cantidad de bytes.
+ * @return Cantidad de bytes encolados o -1 en error.
+ */
+int sys_consola_escribir(const char *buf, uint32_t len);
+
+/*!
+ * @brief Asigna un canal a la tarea actual (SYS_CONSOLE_BIND).
+ *
+ * @param[in] canal Canal, de 0 a CONSOLA_CANALES - 1.
+ * @return 0 o -1 si el canal no existe.
+ */
+int sys_consola_asignar(uint32_t canal);
+
+/*!
+ * @brief Vacía la cola de un canal esperando sobre el FIFO, sin depender de la interrupción.
+ *        Para antes de detener la CPU con las IRQ deshabilitadas.
+ *
+ * @param[in] canal Canal a vaciar.
+ * @return None
+ */
+void consola_vaciar(uint32_t canal);
+
+/*!
+ * @brief Mitad superior de la interrupción de transmisión de un canal: rellena el FIFO desde la cola.
+ *
+ * @param[in] canal Canal que interrumpió.
+ * @return None
+ */
+void consola_irq(uint32_t canal);
+
+/*!
+ * @brief Imprime los bytes, esperas e interrupciones de cada canal.
+ *
+ * @return None
+ */
+void consola_report(void);
+
+#endif // CONSOLA_H_
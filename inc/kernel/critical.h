@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    critical.h
+ * @brief   Macros para secciones críticas con interrupciones deshabilitadas
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef CRITICAL_H_
+#define CRITICAL_H_
+
+#include <stdint.h>
+
+/*!
+ * @brief Guarda el CPSR en flags y deshabilita las IRQ.
+ */
+#define IRQ_SAVE(flags) __asm__ volatile("MRS %0, CPSR\n\tCPSID i" : "=r"(flags) : : "memory")
+
+/*!
+ * @brief Restaura el estado de las IRQ guardado por IRQ_SAVE.
+ */
+#define IRQ_RESTORE(flags) __asm__ volatile("MSR CPSR_c, %0" : : "r"(flags) : "memory")
+
+#endif // CRITICAL_H_
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    espacios.h
+ * @brief   Declaración de los espacios de direcciones de las tareas de usuario
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef ESPACIOS_H_
+#define ESPACIOS_H_
+
+#include <stdint.h>
+
+#ifdef AISLAMIENTO
+#ifndef CACHE
+#error "AISLAMIENTO necesita la MMU: compilar con CACHE=1"
+#endif
+#endif
+
+// Las tareas 1 a 3 tienen un espacio cada una; las de carga comparten uno porque corren el mismo programa
+#if STRESS_TAREAS > 0
+#define ESPACIOS_CANT 4U
+#else
+#define ESPACIOS_CANT 3U
+#endif
+
+#define ABORT_DATOS 0U
+#define ABORT_PREFETCH 1U
+
+/*!
+ * @brief Arma los espacios de las tareas de usuario y las pasa a modo USR. La idle y la worker
+ *        siguen en modo SYS con el espacio del kernel. La llama scheduler_init con los TCB armados.
+ *
+ * @return None
+ */
+void espacios_init(void);
+
+/*!
+ * @brief Activa el espacio de la tarea entrante en la CPU local. No hace nada si ya estaba activo.
+ *
+ * @param[in] tcb TCB de la tarea entrante.
+ * @return None
+ */
+void espacios_activar(const tcb_t *tcb);
+
+/*!
+ * @brief Atiende un data abort o prefetch abort. Si la falla es de una tarea de usuario la termina;
+ *        si es del kernel reporta y detiene la CPU.
+ *
+ * @param[in] tipo ABORT_DATOS o ABORT_PREFETCH.
+ * @param[in] spsr SPSR del modo abort (modo de la tarea interrumpida).
+ * @param[in] pc Instrucción que falló.
+ * @return Dirección en la que sigue la tarea (modo usuario).
+ */
+uint32_t C_abort_handler(uint32_t tipo, uint32_t spsr, uint32_t pc);
+
+/*!
+ * @brief Valida un puntero recibido de una tarea contra su espacio. Sin AISLAMIENTO, o para las tareas
+ *        con el espacio del kernel, todo es accesible.
+ *
+ * @param[in] tcb Tarea dueña del puntero (no necesariamente la actual).
+ * @param[in] ptr Primera dirección.
+ * @param[in] largo Bytes que se van a acceder.
+ * @param[in] escribir 0 si el kernel solo lee, 1 si escribe.
+ * @return 1 si la tarea puede acceder a todo el rango, 0 si no.
+ */
+uint32_t espacios_usuario_valido(const tcb_t *tcb, const void *ptr, uint32_t largo, uint32_t escribir);
+
+/*!
+ * @brief Mide una cadena terminada en '\0' de una tarea, validando cada página antes de leerla.
+ *
+ * @param[in] tcb Tarea dueña de la cadena.
+ * @param[in] s Cadena.
+ * @return Largo sin el terminador, o -1 si es NULL o sale del espacio de la tarea.
+ */
+int32_t espacios_usuario_cadena(const tcb_t *tcb, const char *s);
+
+#endif // ESPACIOS_H_
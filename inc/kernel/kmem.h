@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    kmem.h
+ * @brief   Declaración del asignador de memoria del kernel por slabs de tamaño fijo
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef KMEM_H_
+#define KMEM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+extern uint32_t _kernel_heap_start_;
+extern uint32_t _kernel_heap_end_;
+
+#define KMEM_SLAB_SIZE 4096  // Tamaño de cada slab (alineado a su tamaño)
+#define KMEM_CACHE_LINE 64   // Línea de cache del Cortex-A8/A9
+#define KMEM_MAX_CACHES 16   // Cantidad máxima de caches
+#define KMEM_CANT_CLASES 6   // Clases de tamaño de kmalloc: 16 a 512 bytes
+
+#define KMEM_FLAG_LINEA (1U << 0) // Objetos alineados a línea de cache (usados desde IRQ)
+
+typedef struct
+{
+    uint32_t allocs;     // Asignaciones exitosas
+    uint32_t frees;      // Liberaciones
+    uint32_t en_uso;     // Objetos asignados actualmente
+    uint32_t max_en_uso; // Máximo de objetos asignados a la vez
+    uint32_t slabs;      // Slabs tomados del heap
+    uint32_t fallos;     // Asignaciones fallidas por falta de memoria
+} kmem_stats_t;
+
+struct kmem_cache;
+
+typedef struct kmem_slab
+{
+    struct kmem_cache *cache; // Cache dueño del slab, permite liberar en O(1)
+    struct kmem_slab *sig;
+} kmem_slab_t;
+
+typedef struct kmem_cache
+{
+    const char *nombre;
+    uint32_t tam_objeto; // Tamaño ya redondeado a la alineación
+    uint32_t offset;     // Offset del primer objeto dentro del slab
+    void *libres;        // Lista libre intrusiva: cada objeto libre guarda el siguiente
+    uint8_t *bump;       // Próximo objeto nunca usado del slab actual
+    uint8_t *bump_fin;   // Fin del slab actual
+    kmem_slab_t *slabs;
+    kmem_stats_t stats;
+} kmem_cache_t;
+
+/*!
+ * @brief Inicializa el heap del kernel y las caches de kmalloc.
+ *
+ * @return None
+ */
+void kmem_init(void);
+
+/*!
+ * @brief Crea una cache de objetos de tamaño fijo.
+ *
+ * @param[in] nombre Nombre de la cache para el reporte.
+ * @param[in] tam Tamaño de cada objeto en bytes.
+ * @param[in] flags KMEM_FLAG_LINEA para alinear los objetos a línea de cache.
+ * @return Puntero a la cache o NULL si no hay lugar.
+ */
+kmem_cache_t *kmem_cache_create(const char *nombre, uint32_t tam, uint32_t flags);
+
+/*!
+ * @brief Toma un objeto de la cache en tiempo constante. Se puede llamar desde IRQ y desde cualquier CPU.
+ *
+ * @param[in] cache Cache de la que se toma el objeto.
+ * @return Puntero al objeto o NULL si no hay memoria.
+ */
+void *kmem_cache_alloc(kmem_cache_t *cache);
+
+/*!
+ * @brief Devuelve un objeto a su cache en tiempo constante. Se puede llamar desde IRQ.
+ *
+ * @param[in] cache Cache dueña del objeto.
+ * @param[in] obj Objeto a liberar.
+ * @return None
+ */
+void kmem_cache_free(kmem_cache_t *cache, void *obj);
+
+/*!
+ * @brief Asigna memoria del kernel usando la clase de tamaño más chica que alcance.
+ *
+ * @param[in] tam Tamaño pedido en bytes (hasta 512).
+ * @return Puntero a la memoria o NULL.
+ */
+void *kmalloc(size_t tam);
+
+/*!
+ * @brief Libera memoria obtenida con kmalloc o kmem_cache_alloc.
+ *
+ * @param[in] ptr Puntero a liberar. NULL se ignora.
+ * @return None
+ */
+void kfree(void *ptr);
+
+/*!
+ * @brief Imprime por UART las estadísticas de cada cache.
+ *
+ * @return None
+ */
+void kmem_report(void);
+
+#endif // KMEM_H_
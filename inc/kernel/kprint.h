@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    kprint.h
+ * @brief   Declaración de funciones de impresión por UART desde el kernel
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef KPRINT_H_
+#define KPRINT_H_
+
+#include <stdint.h>
+
+/*!
+ * @brief Imprime una cadena por la UART de consola sin pasar por SVC.
+ *
+ * @param[in] str Cadena terminada en '\0'.
+ * @return None
+ */
+void kprint_str(const char *str);
+
+/*!
+ * @brief Imprime un entero sin signo en decimal.
+ *
+ * @param[in] num Número a imprimir.
+ * @return None
+ */
+void kprint_dec(uint32_t num);
+
+/*!
+ * @brief Imprime un entero sin signo en decimal alineado a derecha.
+ *
+ * @param[in] num Número a imprimir.
+ * @param[in] ancho Ancho mínimo del campo (se completa con espacios).
+ * @return None
+ */
+void kprint_dec_ancho(uint32_t num, uint32_t ancho);
+
+/*!
+ * @brief Imprime un entero sin signo en hexadecimal con prefijo 0x.
+ *
+ * @param[in] num Número a imprimir.
+ * @return None
+ */
+void kprint_hex(uint32_t num);
+
+/*!
+ * @brief División entera sin signo del kernel (el ARMv7-A no tiene UDIV y no se linkea libgcc).
+ *        No depende del código de las tareas.
+ *
+ * @param[in] num Dividendo.
+ * @param[in] den Divisor.
+ * @return Cociente, o 0 si den es 0.
+ */
+uint32_t kdiv(uint32_t num, uint32_t den);
+
+#endif // KPRINT_H_
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    rt.h
+ * @brief   Declaración de la planificación de tiempo real (EDF / rate monotonic)
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef RT_H_
+#define RT_H_
+
+#include <stdint.h>
+
+#if defined(SCHED_EDF) || defined(SCHED_RM)
+#define SCHED_RT
+#endif
+
+#if defined(SCHED_EDF) && defined(SCHED_RM)
+#error "Elegir una sola política de tiempo real: SCHED_EDF o SCHED_RM"
+#endif
+
+#if defined(SCHED_RT) && defined(SMP)
+#error "La planificación de tiempo real está implementada solo para un core"
+#endif
+
+#ifndef RT_REPORT_TICKS
+#define RT_REPORT_TICKS 0 // Cada cuántos ticks se imprime el reporte (0 = nunca)
+#endif
+
+typedef enum
+{
+    RT_INACTIVA = 0, // La tarea no es de tiempo real
+    RT_LISTA,        // Tiene un trabajo activo con presupuesto
+    RT_ESPERANDO,    // Terminó su trabajo y espera la próxima activación
+    RT_AGOTADA,      // Consumió su WCET sin terminar: espera la próxima activación
+} rt_estado_t;
+
+typedef struct
+{
+    uint32_t periodo;     // Ticks entre activaciones
+    uint32_t wcet;        // Presupuesto por trabajo en ticks
+    uint32_t deadline;    // Deadline relativo en ticks
+    uint32_t utilizacion; // wcet / min(periodo, deadline) en por mil
+    rt_estado_t estado;
+    uint8_t miss_contado;
+    uint32_t proxima_activacion; // Tick absoluto de la próxima activación
+    uint32_t deadline_abs;       // Tick absoluto del deadline del trabajo actual
+    uint32_t budget;             // Ticks que le quedan al trabajo actual
+    uint32_t inicio_trabajo;     // clock_ciclos() en la activación
+    uint32_t activaciones;
+    uint32_t completados;
+    uint32_t deadline_misses;
+    uint32_t overruns;
+    uint32_t peor_respuesta_us;
+} rt_tarea_t;
+
+/*!
+ * @brief Deja todas las tareas como no de tiempo real.
+ *
+ * @return None
+ */
+void rt_init(void);
+
+/*!
+ * @brief Declara los parámetros de tiempo real de una tarea y aplica el test de utilización
+ *        (EDF: U <= 1, RM: cota de Liu y Layland).
+ *
+ * @param[in] task_id Tarea.
+ * @param[in] periodo Período en ticks.
+ * @param[in] wcet Presupuesto por trabajo en ticks.
+ * @param[in] deadline Deadline relativo en ticks (<= periodo).
+ * @return 0 si la tarea fue admitida o -1 si no pasa el test.
+ */
+int rt_admitir(uint32_t task_id, uint32_t periodo, uint32_t wcet, uint32_t deadline);
+
+/*!
+ * @brief Indica si una tarea fue admitida como de tiempo real.
+ *
+ * @param[in] task_id Tarea.
+ * @return 1 si es de tiempo real, 0 si no.
+ */
+uint32_t rt_es_tiempo_real(uint32_t task_id);
+
+/*!
+ * @brief Contabiliza el tick: consume presupuesto, detecta deadlines vencidos y activa trabajos.
+ *
+ * @param[in] actual Tarea que estaba corriendo durante el tick.
+ * @return None
+ */
+void rt_tick(tcb_t *actual);
+
+/*!
+ * @brief Elige la tarea de tiempo real lista de mayor prioridad (EDF o RM).
+ *
+ * @return TCB elegido o NULL si no hay ninguna lista.
+ */
+tcb_t *rt_elegir(void);
+
+/*!
+ * @brief Implementación de la llamada al sistema que cierra el trabajo del período.
+ *
+ * @param[in] task_id Tarea que llama.
+ * @return 1 si la tarea debe dejar la CPU hasta su próxima activación, 0 si puede seguir.
+ */
+int sys_rt_esperar(uint32_t task_id);
+
+/*!
+ * @brief Imprime por UART los parámetros y contadores de cada tarea de tiempo real.
+ *
+ * @return None
+ */
+void rt_report(void);
+
+#endif // RT_H_
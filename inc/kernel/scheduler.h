@@ -30,6 +30,8 @@
 #define SCHEDULER_H_
 
 #include "defines.h"
+#include "kernel/spinlock.h"
+#include "kernel/smp.h"
 
 #define MODE_USER 0x10 // Modo de usuario
 #define MODE_FIQ 0x11  // Modo FIQ
@@ -40,25 +42,37 @@
 #define MODE_SYS 0x1F  // Modo System
 
 extern uint32_t MAX_TASKS;
-extern uint32_t _tareaidle_irq_stack_top_;
+extern uint32_t _tareaidle_stack_start_;
 extern uint32_t _tareaidle_svc_stack_top_;
 extern uint32_t _tareaidle_sys_stack_top_;
-extern uint32_t _tarea1_irq_stack_top_;
+extern uint32_t _tarea1_stack_start_;
 extern uint32_t _tarea1_svc_stack_top_;
 extern uint32_t _tarea1_sys_stack_top_;
-extern uint32_t _tarea2_irq_stack_top_;
+extern uint32_t _tarea2_stack_start_;
 extern uint32_t _tarea2_svc_stack_top_;
 extern uint32_t _tarea2_sys_stack_top_;
-extern uint32_t _tarea3_irq_stack_top_;
+extern uint32_t _tarea3_stack_start_;
 extern uint32_t _tarea3_svc_stack_top_;
 extern uint32_t _tarea3_sys_stack_top_;
+extern uint32_t _tareaworker_stack_start_;
+extern uint32_t _tareaworker_svc_stack_top_;
+extern uint32_t _tareaworker_sys_stack_top_;
 
 extern void tarea_idle(void);
 extern void tarea1(void);
 extern void tarea2(void);
 extern void tarea3(void);
+extern void tarea_worker(void);
 
-#define CANT_TASKS 4
+// Tareas del generador de carga (make STRESS=<N>); van después de las fijas
+#ifndef STRESS_TAREAS
+#define STRESS_TAREAS 0
+#endif
+#if STRESS_TAREAS > 256
+#error "STRESS admite hasta 256 tareas"
+#endif
+
+#define CANT_TASKS (TASK_STRESS_BASE + STRESS_TAREAS)
 
 typedef enum
 {
@@ -66,9 +80,17 @@ typedef enum
     TASK_1,
     TASK_2,
     TASK_3,
-    TASK_INIT,
+    TASK_WORKER,      // Ejecuta el trabajo diferido de la workqueue
+    TASK_STRESS_BASE, // Primera tarea del generador de carga
+    TASK_INIT = 0xFFFF, // Contexto de arranque de cada CPU: fuera del rango de tareas
 } task_id_t;
 
+typedef enum
+{
+    TAREA_LISTA = 0,  // En una run queue o corriendo
+    TAREA_BLOQUEADA,  // Esperando un evento, fuera de las run queues
+} task_state_t;
+
 typedef union
 {
     uint32_t xPSR;
@@ -99,24 +121,122 @@ typedef struct
     uint32_t ticks_actuales;
     void (*ptr_tarea)(void);
     task_id_t task_id;
-    uint32_t *sp_irq;
-    uint32_t *sp_svc;
+    task_state_t estado;
+    uint32_t *sp_irq;  // Frame de la última excepción, en la pila de kernel de la tarea
     uint32_t *sp_sys;
-    uint32_t *lr_svc;
     uint32_t *lr_sys;
     xPSR_t spsr;
-} tcb_t;
+    uint32_t dormir_hasta; // Tick en que vence SYS_SLEEP_TICKS
+    uint32_t despertada;   // Ciclos del reloj al despertarse, 0 si no está pendiente de medir
+    void *tls;             // Arena de heap de la tarea (TPIDRURO), NULL si no tiene
+    mmu_espacio_t *espacio; // Espacio de direcciones (AISLAMIENTO), NULL es el del kernel
+    volatile uint8_t en_cpu; // Elegida por una CPU que todavía no salió de su pila de kernel
+} ALINEADO_CACHE tcb_t;
 
 typedef struct
 {
-    tcb_t tareas[CANT_TASKS];
-    task_id_t task_id_actual;
+    task_id_t cola[CANT_TASKS]; // Cola circular de tareas listas
+    uint32_t inicio;
+    uint32_t cant;
+    spinlock_t lock;
+} ALINEADO_CACHE runqueue_t;
+
+typedef struct
+{
+    tcb_t *actual;           // Tarea que está corriendo en esta CPU
+    tcb_t *ocioso;           // Lo que corre cuando no hay nada listo ni para robar
+    tcb_t idle;              // Contexto de arranque de la CPU (ocioso de las CPUs secundarias)
+    runqueue_t rq;           // Run queue propia de la CPU
     uint8_t run;
+    volatile uint8_t resched; // Replanificación pedida por SGI
+    tcb_t *saliente;         // Tarea desalojada: se encola recién cuando la CPU dejó su pila de kernel
+    uint32_t cambios;        // Cambios de contexto
+    uint32_t robos;          // Tareas robadas a otras CPUs
+    uint32_t ticks_ocupados;
+    uint32_t ticks_ociosos;
+} ALINEADO_CACHE cpu_t;
+
+typedef struct
+{
+    tcb_t tareas[CANT_TASKS];
+    cpu_t cpus[CANT_CPUS];
 } tcb_context_t;
 
 void scheduler_init(void);
-void scheduler(void);
+void scheduler_tcb_init(tcb_t *tcb, task_id_t task_id, uint32_t ticks, void (*tarea)(void),
+                        uint32_t *kernel_top, uint32_t *sys_top);
+tcb_t *scheduler_actual(void);
 void save_context(tcb_t *tcb, uint32_t *sp_irq);
 void context_switch(tcb_t *tcb, uint32_t **sp_irq);
 
+/*!
+ * @brief Replanifica desde una llamada al sistema, sin esperar al tick.
+ *
+ * @param[in] frame_svc Frame guardado por svc_handler.
+ * @return Frame a restaurar: el mismo si no hubo cambio, o el de la tarea entrante.
+ */
+uint32_t *scheduler_yield(uint32_t *frame_svc);
+
+/*!
+ * @brief Cuenta un tick para la tarea actual y la CPU local (quantum, ticks ociosos y ocupados) y avanza
+ *        el tiempo real. Corre en cada tick, aunque el cambio de tarea quede postergado por una softirq.
+ *
+ * @return None
+ */
+void scheduler_tick(void);
+
+/*!
+ * @brief Elige la próxima tarea de la CPU local. La llaman el tick, después de scheduler_tick, y el
+ *        pedido de otra CPU (SGI), que no cuenta un tick ni consume presupuesto de tiempo real.
+ *
+ * @return None
+ */
+void scheduler_replanificar(void);
+
+/*!
+ * @brief Encola la tarea que dejó la CPU. La llaman irq_handler y svc_handler con las IRQ deshabilitadas,
+ *        después de pasar a la pila de kernel de la tarea entrante: recién ahí otra CPU la puede retomar.
+ *
+ * @return None
+ */
+void scheduler_fin_cambio(void);
+
+/*!
+ * @brief Marca a la tarea actual como bloqueada. Después hay que llamar a scheduler_yield.
+ *
+ * @return None
+ */
+void scheduler_bloquear_actual(void);
+
+/*!
+ * @brief Vuelve a poner una tarea bloqueada en la run queue de la CPU local.
+ *
+ * @param[in] tcb Tarea a despertar.
+ * @return None
+ */
+void scheduler_despertar(tcb_t *tcb);
+
+/*!
+ * @brief Duerme a la tarea actual durante una cantidad de ticks. Después hay que llamar a scheduler_yield.
+ *
+ * @param[in] ticks Ticks a dormir; 0 vuelve enseguida.
+ * @return 1 si la tarea quedó bloqueada, 0 si no.
+ */
+uint32_t sys_dormir(uint32_t ticks);
+
+/*!
+ * @brief Cuenta el tick en la CPU0 y despierta a las tareas cuyo sueño venció.
+ *
+ * @return None
+ */
+void scheduler_dormidas_tick(void);
+
+/*!
+ * @brief Publica la arena de heap de la tarea entrante en TPIDRURO (y la struct _reent de la newlib).
+ *
+ * @param[in] tcb TCB de la tarea entrante.
+ * @return None
+ */
+void scheduler_tls_cargar(tcb_t *tcb);
+
 #endif // SCHEDULER_H_
\ No newline at end of file
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    smp.h
+ * @brief   Declaración de funciones para el arranque y la coordinación de múltiples CPUs
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef SMP_H_
+#define SMP_H_
+
+#include <stdint.h>
+
+#ifndef CANT_CPUS
+#define CANT_CPUS 1 // Sin SMP el kernel corre solo en la CPU0
+#endif
+
+#define SMP_MAX_CPUS 4 // Cortex-A9 MPCore: hasta 4 CPUs (ver memmap.ld)
+
+extern uint32_t _cpu_stacks_start_;
+extern uint32_t _cpu_stack_block_size_;
+extern void _start_secundario(void);
+
+/*!
+ * @brief Dirección de arranque publicada para el holding pen de startup.s.
+ */
+extern volatile uint32_t smp_entrada;
+
+/*!
+ * @brief Devuelve el número de la CPU que ejecuta la función.
+ *
+ * @return 0 a CANT_CPUS - 1.
+ */
+uint32_t cpu_id(void);
+
+/*!
+ * @brief Libera a las CPUs secundarias del holding pen. La llama la CPU0 al final de board_init.
+ *
+ * @return None
+ */
+void smp_boot_secundarios(void);
+
+/*!
+ * @brief Inicialización en C de cada CPU secundaria, llamada desde _start_secundario.
+ *
+ * @return None
+ */
+void smp_secundario_init(void);
+
+/*!
+ * @brief Pide a una CPU que replanifique enviándole un SGI.
+ *
+ * @param[in] cpu CPU destino.
+ * @return None
+ */
+void smp_send_resched(uint32_t cpu);
+
+/*!
+ * @brief Manejador del SGI de replanificación.
+ *
+ * @param[in] sp_irq Stack pointer con el contexto guardado.
+ * @return Stack pointer del contexto a restaurar.
+ */
+uint32_t *RESCHED_IRQHandler(uint32_t *sp_irq);
+
+/*!
+ * @brief Imprime por UART los contadores de cada CPU.
+ *
+ * @return None
+ */
+void smp_report(void);
+
+#endif // SMP_H_
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    softirq.h
+ * @brief   Declaración de las softirqs (mitades inferiores) y de la medición de tiempo con IRQ deshabilitadas
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef SOFTIRQ_H_
+#define SOFTIRQ_H_
+
+#include <stdint.h>
+
+// Cada cuántos ticks se encola el reporte de tiempo con IRQ deshabilitadas. 0 = nunca (make IRQOFF=<ticks>).
+#ifndef IRQOFF_REPORT_TICKS
+#define IRQOFF_REPORT_TICKS 0
+#endif
+
+// Vueltas máximas sobre el bitmap por salida de IRQ; lo que quede corre en la próxima
+#define SOFTIRQ_MAX_VUELTAS 4U
+
+typedef enum
+{
+    SOFTIRQ_TIMER = 0, // Mantenimiento del reloj y reportes periódicos
+    SOFTIRQ_UART_RX,   // Despierta a los lectores de la UART0
+    SOFTIRQ_DMA,       // Libera lo transmitido y arranca el próximo lote de DMA
+    SOFTIRQ_CANT,
+} softirq_t;
+
+typedef enum
+{
+    IRQOFF_IRQ = 0, // Mitad superior: de C_IRQ_handler hasta habilitar las IRQ en la salida
+    IRQOFF_SVC,     // Llamadas al sistema (con SVC_EXPROPIABLE, cada tramo con las IRQ deshabilitadas)
+    IRQOFF_CANT,
+} irqoff_tipo_t;
+
+typedef struct
+{
+    uint32_t max;  // Ciclos de CPU
+    uint32_t prom; // Promedio móvil exponencial (1/16): no desborda como una suma
+    uint32_t cant;
+} irqoff_stats_t;
+
+typedef struct
+{
+    volatile uint32_t pendientes; // Bitmap de softirq_t
+    volatile uint32_t ticks;      // Ticks del timer todavía no procesados por SOFTIRQ_TIMER
+    uint8_t en_curso;
+    uint32_t entrada; // Ciclo en que se deshabilitaron las IRQ
+    uint32_t ejecutadas;
+    irqoff_stats_t stats[IRQOFF_CANT];
+} ALINEADO_CACHE softirq_cpu_t;
+
+/*!
+ * @brief Marca una softirq como pendiente en la CPU local. Se llama desde una mitad superior.
+ *
+ * @param[in] n Softirq a marcar.
+ * @return None
+ */
+void softirq_raise(softirq_t n);
+
+/*!
+ * @brief Cuenta un tick del timer y marca SOFTIRQ_TIMER en la CPU local. Se llama desde tick_handler;
+ *        si el tick llega con la softirq todavía pendiente, se procesa igual en la próxima pasada.
+ *
+ * @return None
+ */
+void softirq_tick(void);
+
+/*!
+ * @brief Indica si la CPU local está corriendo softirqs. Mientras tanto el tick no cambia de tarea.
+ *
+ * @return 1 si hay softirqs en curso, 0 si no.
+ */
+uint32_t softirq_en_curso(void);
+
+/*!
+ * @brief Corre las softirqs pendientes de la CPU local. La llama irq_handler en modo SVC,
+ *        sobre la pila de softirqs de la CPU (softirq_pila) y con las IRQ habilitadas.
+ *
+ * @return None
+ */
+void softirq_ejecutar(void);
+
+/*!
+ * @brief Tope de la pila de softirqs de la CPU local: _softirq_stack_top_ en la CPU0 y el final
+ *        del bloque de pilas de cada CPU secundaria (SOFTIRQ_STACK_SIZE en el linker script).
+ *
+ * @return Tope de la pila (full descending).
+ */
+uint32_t *softirq_pila(void);
+
+/*!
+ * @brief Registra el ciclo en que se deshabilitaron las IRQ (entrada a C_IRQ_handler o C_SVC_handler).
+ *
+ * @return None
+ */
+void irqoff_entrada(void);
+
+/*!
+ * @brief Acumula el tiempo transcurrido desde irqoff_entrada.
+ *
+ * @param[in] tipo Origen de la sección con IRQ deshabilitadas.
+ * @return None
+ */
+void irqoff_salida(irqoff_tipo_t tipo);
+
+/*!
+ * @brief Cierre de la mitad superior. La llama irq_handler antes de restaurar el contexto.
+ *
+ * @return Distinto de 0 si hay softirqs para correr.
+ */
+uint32_t irq_salida(void);
+
+/*!
+ * @brief Imprime por UART el tiempo máximo y promedio con IRQ deshabilitadas de cada CPU.
+ *
+ * @return None
+ */
+void irqoff_report(void);
+
+#endif // SOFTIRQ_H_
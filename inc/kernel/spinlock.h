@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    spinlock.h
+ * @brief   Declaración de spinlocks basados en LDREX/STREX con WFE/SEV
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef SPINLOCK_H_
+#define SPINLOCK_H_
+
+#include <stdint.h>
+
+typedef struct
+{
+    volatile uint32_t lock; // 0 = libre, 1 = tomado
+} spinlock_t;
+
+#define SPINLOCK_INIT {0}
+
+/*!
+ * @brief Toma el spinlock. Mientras está ocupado la CPU espera con WFE.
+ *
+ * @param[in] sl Spinlock a tomar.
+ * @return None
+ */
+void spin_lock(spinlock_t *sl);
+
+/*!
+ * @brief Libera el spinlock y despierta con SEV a las CPUs que esperan.
+ *
+ * @param[in] sl Spinlock a liberar.
+ * @return None
+ */
+void spin_unlock(spinlock_t *sl);
+
+/*!
+ * @brief Deshabilita las IRQ de la CPU local y toma el spinlock.
+ *
+ * @param[in] sl Spinlock a tomar.
+ * @return CPSR previo, para pasarlo a spin_unlock_irqrestore.
+ */
+uint32_t spin_lock_irqsave(spinlock_t *sl);
+
+/*!
+ * @brief Libera el spinlock y restaura el estado de las IRQ.
+ *
+ * @param[in] sl Spinlock a liberar.
+ * @param[in] flags Valor devuelto por spin_lock_irqsave.
+ * @return None
+ */
+void spin_unlock_irqrestore(spinlock_t *sl, uint32_t flags);
+
+#endif // SPINLOCK_H_
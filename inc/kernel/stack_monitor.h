@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    stack_monitor.h
+ * @brief   Declaración de funciones para el pintado y monitoreo de las pilas de las tareas
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef STACK_MONITOR_H_
+#define STACK_MONITOR_H_
+
+#include <stdint.h>
+
+#define STACK_PAINT 0xA5A5A5A5U  // Patrón con el que se pintan las pilas sin usar
+#define STACK_CANARY 0xC0DEC0DEU // Palabra más baja de cada pila, no debe modificarse nunca
+#define STACK_SCAN_WORDS 16      // Palabras revisadas por cada paso del escaneo incremental
+#define STACK_KERNEL_PALABRAS ((uint32_t)&_tareas_kstack_size_ / 4U) // Pila de kernel de cada tarea
+#define STACK_TAREA_PALABRAS ((uint32_t)&_tareas_stack_size_ / 4U)   // Pila SYS de cada tarea
+
+// Tamaños en bytes que define el linker script (TAREAS_KSTACK_SIZE y TAREAS_STACK_SIZE): valen su dirección
+extern uint32_t _tareas_kstack_size_;
+extern uint32_t _tareas_stack_size_;
+
+typedef enum
+{
+    STACK_KERNEL = 0, // Pila de SVC: frames de las excepciones y llamadas al sistema
+    STACK_SYS,
+    STACK_CANT_MODOS,
+} stack_modo_t;
+
+typedef struct
+{
+    uint32_t *base;   // Dirección más baja de la pila (contiene el canario)
+    uint32_t *top;    // Tope de la pila (full descending)
+    uint32_t *marca;  // Palabra usada más baja encontrada hasta ahora
+    uint32_t *cursor; // Próxima palabra a revisar por el escaneo incremental
+} stack_info_t;
+
+/*!
+ * @brief Pinta todas las pilas de las tareas y coloca los canarios.
+ *        Debe llamarse antes de armar el contexto inicial de las tareas.
+ *
+ * @return None
+ */
+void stack_monitor_init(void);
+
+/*!
+ * @brief Revisa hasta STACK_SCAN_WORDS palabras de una pila y actualiza su marca de agua.
+ *        Pensada para llamarse desde la tarea idle.
+ *
+ * @return None
+ */
+void stack_scan_step(void);
+
+/*!
+ * @brief Verifica los canarios de las pilas de una tarea. Si alguno fue pisado
+ *        imprime el reporte y detiene el CPU.
+ *
+ * @param[in] task_id Tarea a verificar.
+ * @return None
+ */
+void stack_check_canary(uint32_t task_id);
+
+/*!
+ * @brief Devuelve la máxima cantidad de bytes usados de una pila.
+ *
+ * @param[in] task_id Tarea.
+ * @param[in] modo Pila de la tarea (kernel o SYS).
+ * @return Bytes usados o -1 si los parámetros son inválidos.
+ */
+int stack_max_usado(uint32_t task_id, uint32_t modo);
+
+/*!
+ * @brief Imprime por UART el uso máximo de cada pila de cada tarea.
+ *
+ * @return None
+ */
+void stack_report(void);
+
+#endif // STACK_MONITOR_H_
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    stress.h
+ * @brief   Declaración del generador de carga sintética y sus métricas de escalabilidad
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef STRESS_H_
+#define STRESS_H_
+
+#include <stdint.h>
+
+// Ticks de medición desde el primer despacho; al terminar se encola el reporte (make STRESS_TICKS=<ticks>)
+#ifndef STRESS_DURACION_TICKS
+#define STRESS_DURACION_TICKS 1000U
+#endif
+
+// Pesos de la mezcla de trabajo de cada tarea (make STRESS_CALC/STRESS_SYS/STRESS_OUT/STRESS_SLEEP=<peso>)
+#ifndef STRESS_PESO_CALCULO
+#define STRESS_PESO_CALCULO 8U
+#endif
+#ifndef STRESS_PESO_SYSCALL
+#define STRESS_PESO_SYSCALL 4U
+#endif
+#ifndef STRESS_PESO_SALIDA
+#define STRESS_PESO_SALIDA 1U
+#endif
+#ifndef STRESS_PESO_SUENO
+#define STRESS_PESO_SUENO 3U
+#endif
+#define STRESS_PESO_TOTAL (STRESS_PESO_CALCULO + STRESS_PESO_SYSCALL + STRESS_PESO_SALIDA + STRESS_PESO_SUENO)
+
+#define STRESS_QUANTUM 2U                    // Ticks por turno de cada tarea de carga
+#define STRESS_PILA_PALABRAS STACK_TAREA_PALABRAS   // Pila SYS
+#define STRESS_KPILA_PALABRAS STACK_KERNEL_PALABRAS // Pila de kernel
+#define STRESS_LAT_CANT 20U                  // Histograma en potencias de 2 de us: hasta ~0,5 s
+
+typedef enum
+{
+    STRESS_ESPERANDO = 0, // Todavía no hubo un despacho
+    STRESS_MIDIENDO,
+    STRESS_TERMINADO,
+} stress_estado_t;
+
+typedef struct
+{
+    uint64_t ciclos_sched; // Ciclos de PMU dentro del scheduler mientras se mide
+    uint64_t ciclos_total; // Ciclos de PMU entre ticks mientras se mide
+    uint32_t ccnt_tick;    // Contador de ciclos en el tick anterior
+    uint32_t ccnt_sched;   // Contador de ciclos al entrar al scheduler
+    uint32_t syscalls;
+    uint32_t lat_hist[STRESS_LAT_CANT]; // Despertar -> volver a ser elegida, en us
+    uint32_t lat_max;
+} stress_cpu_t;
+
+typedef struct
+{
+    volatile uint32_t estado; // stress_estado_t
+    uint32_t ticks;
+    uint32_t inicio_us;
+    uint32_t fin_us;
+    uint32_t items;    // Diferencias entre el inicio y el fin de la medición
+    uint32_t cambios;
+    uint32_t syscalls;
+    stress_cpu_t cpus[CANT_CPUS];
+} stress_t;
+
+/*!
+ * @brief Devuelve la base de una de las pilas de una tarea de carga. La de kernel y la SYS van en secciones separadas.
+ *
+ * @param[in] n Número de tarea de carga, desde 0.
+ * @param[in] modo Pila: STACK_KERNEL o STACK_SYS.
+ * @return Primera palabra de la pila; el tope está STRESS_KPILA_PALABRAS (kernel) o STRESS_PILA_PALABRAS (SYS) más arriba.
+ */
+uint32_t *stress_pila(uint32_t n, uint32_t modo);
+
+/*!
+ * @brief Crea los TCB de las tareas de carga. La llama scheduler_init antes del reparto inicial.
+ *
+ * @return None
+ */
+void stress_init(void);
+
+/*!
+ * @brief Acumula los ciclos de la CPU local desde el tick anterior. Se llama al entrar a tick_handler.
+ *
+ * @return None
+ */
+void stress_ciclos_tick(void);
+
+/*!
+ * @brief Marca la entrada al scheduler en la CPU local.
+ *
+ * @return None
+ */
+void stress_sched_entrada(void);
+
+/*!
+ * @brief Suma los ciclos pasados en el scheduler desde stress_sched_entrada.
+ *
+ * @return None
+ */
+void stress_sched_salida(void);
+
+/*!
+ * @brief Cuenta una llamada al sistema en la CPU local.
+ *
+ * @return None
+ */
+void stress_syscall(void);
+
+/*!
+ * @brief Registra la latencia entre el despertar de una tarea y su elección por el scheduler.
+ *
+ * @param[in] tcb Tarea elegida; tcb->despertada tiene el reloj del despertar.
+ * @return None
+ */
+void stress_latencia(tcb_t *tcb);
+
+/*!
+ * @brief Avanza la medición en la CPU0: la arranca en el primer tick y al terminar encola el reporte.
+ *
+ * @return None
+ */
+void stress_tick(void);
+
+/*!
+ * @brief Imprime trabajo por segundo, cambios de contexto por segundo, sobrecarga del scheduler y latencias.
+ *
+ * @return None
+ */
+void stress_report(void);
+
+#endif // STRESS_H_
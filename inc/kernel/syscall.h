@@ -41,9 +41,56 @@ typedef long int blksize_t;
 
 typedef enum
 {
-    SYS_WRITE = 4, // Escribe datos en un descriptor de archivo
+    SYS_EXIT = 1,           // Termina la tarea actual: no vuelve a planificarse
+    SYS_READ = 3,           // Lee datos de un descriptor de archivo; bloquea hasta que haya
+    SYS_WRITE = 4,          // Escribe datos en un descriptor de archivo
+    SYS_GETPID = 20,        // Devuelve el task_id de la tarea actual
+    SYS_SCHED_YIELD = 158,  // Cede la CPU a la próxima tarea lista
+    SYS_CLOCK_GETTIME = 263, // Lee un reloj del sistema
+    SYS_STACK_USAGE = 0x100, // Devuelve el uso máximo de una pila de una tarea
+    SYS_RT_WAIT = 0x101,     // Cierra el trabajo periódico y espera la próxima activación
+    SYS_WORK_WAIT = 0x102,   // La tarea worker espera que haya trabajo en la workqueue
+    SYS_SLEEP_TICKS = 0x103, // Duerme a la tarea una cantidad de ticks
+    SYS_RING_SETUP = 0x104,  // Registra los anillos de envío y de completado de la tarea
+    SYS_RING_ENTER = 0x105,  // Procesa los envíos publicados y opcionalmente espera completions
+    SYS_WRITE_LEN = 0x106,   // Escribe un buffer de largo explícito (_write de la newlib)
+    SYS_CONSOLE_BIND = 0x108, // Asigna un canal (UART) de la consola a la tarea actual; 0x107 es SYS_CLOCK_GETTIME
+    SYS_LOG = 0x109,          // Envía un registro ya armado de la bitácora binaria
 } svc_call_t;
 
+// El SVC de Thumb lleva un inmediato de 8 bits: con THUMB el número viaja en R12 y la instrucción
+// es SVC #SVC_NUM_EN_R12. svc_handler decodifica los dos formatos según el SPSR.T de la llamada.
+#define SVC_NUM_EN_R12 0xFF
+#define SVC_PSR_T 0x20U // SPSR.T: la llamada vino de código Thumb (SVC de 2 bytes)
+#define SVC_STR_(x) #x
+#define SVC_STR(x) SVC_STR_(x)
+#ifdef THUMB
+#define SVC_INSTR(num) "MOVW R12, " num "\n\tSVC #" SVC_STR(SVC_NUM_EN_R12) "\n\t"
+#else
+#define SVC_INSTR(num) "SVC " num "\n\t"
+#endif
+
+#ifdef SVC_EXPROPIABLE
+// La parte larga de una llamada corre con las IRQ habilitadas. Un tick en el medio desaloja a la tarea
+// en modo SVC: el frame de la IRQ queda anidado en su pila de kernel, con el LR de SVC, y la retoma desde ahí.
+// El tiempo con IRQ deshabilitadas se mide por tramos.
+#define SVC_IRQ_HABILITAR()                             \
+    do                                                  \
+    {                                                   \
+        irqoff_salida(IRQOFF_SVC);                      \
+        __asm__ volatile("CPSIE i" : : : "memory");     \
+    } while (0)
+#define SVC_IRQ_DESHABILITAR()                          \
+    do                                                  \
+    {                                                   \
+        __asm__ volatile("CPSID i" : : : "memory");     \
+        irqoff_entrada();                               \
+    } while (0)
+#else
+#define SVC_IRQ_HABILITAR()
+#define SVC_IRQ_DESHABILITAR()
+#endif
+
 /*!
  * @brief Funcion que escribe en pantalla.
  *
@@ -53,13 +100,23 @@ typedef enum
  */
 int sys_my_printf(const char *buf);
 
+/*!
+ * @brief Funcion que escribe en pantalla un buffer de largo explícito.
+ *
+ * @param[in] buf Buffer de datos a escribir; puede no estar terminado en '\0'.
+ * @param[in] len Cantidad de bytes a escribir.
+ * 
+ * @return	  Devuelve la cantidad de bytes escritos o -1 en error.
+ */
+int sys_my_printf_len(const char *buf, uint32_t len);
+
 /*!
  * @brief Funcion para manejar la interrupción del temporizador 0.
  *
  * @param[in] num Número de la llamada al sistema.
  * @param[in] arg1 Primer argumento de la llamada al sistema.
  * @param[in] sp_irq Variable de entrada que recibe el stack pointer.
- * @return	  Devuelve el stack pointer original.
+ * @return	  Devuelve el frame a restaurar: el original, o el de otra tarea si la llamada replanificó.
  */
 uint32_t *C_SVC_handler(uint32_t svc_num, uint32_t *regs);
 
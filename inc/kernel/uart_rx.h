@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    uart_rx.h
+ * @brief   Declaración de la recepción por interrupción de la UART0 y de la llamada read
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef UART_RX_H_
+#define UART_RX_H_
+
+#include <stdint.h>
+
+#define STDIN_FILENO 0
+
+#define UART_RX_BUF 256U // Buffer circular de recepción; potencia de 2
+
+// El lector se bloqueó: C_SVC_handler repite el SVC al despertarse; nunca llega al usuario
+#define UART_RX_REINTENTAR (-2)
+
+#define UART_RX_ESPERANDO_PALABRAS ((CANT_TASKS + 31U) / 32U) // Bitmap de lectores, uno por tarea
+
+// Registros del PL011 usados para la recepción
+#define PL011_REG(base, off) (*(volatile uint32_t *)((base) + (off)))
+#define PL011_DR 0x000U
+#define PL011_FR 0x018U
+#define PL011_IFLS 0x034U
+#define PL011_IMSC 0x038U
+#define PL011_MIS 0x040U
+#define PL011_ICR 0x044U
+
+#define PL011_FR_RXFE (1U << 4)
+#define PL011_IFLS_RX_MITAD (2U << 3) // Interrumpe con el FIFO de recepción a la mitad
+#define PL011_INT_RX (1U << 4)
+#define PL011_INT_RT (1U << 6)        // Timeout: quedaron bytes en el FIFO sin llegar al umbral
+#define PL011_INT_OE (1U << 10)
+
+typedef struct
+{
+    uint32_t recibidos;
+    uint32_t descartados; // Buffer lleno
+    uint32_t overruns;    // El FIFO de la UART se llenó antes de vaciarlo
+    uint32_t interrupciones;
+} uart_rx_stats_t;
+
+/*!
+ * @brief Habilita las interrupciones de recepción de la UART0 (umbral del FIFO y timeout).
+ *
+ * @return None
+ */
+void uart_rx_init(void);
+
+/*!
+ * @brief Mitad superior: vacía el FIFO de recepción al buffer circular y marca SOFTIRQ_UART_RX.
+ *
+ * @return None
+ */
+void UART0_IRQHandler(void);
+
+/*!
+ * @brief Mitad inferior: despierta a las tareas bloqueadas en read.
+ *
+ * @return None
+ */
+void uart_rx_softirq(void);
+
+/*!
+ * @brief Implementación de read sobre la entrada estándar (UART0).
+ *        Si no hay datos marca a la tarea actual como bloqueada.
+ *
+ * @param[in] fd Descriptor; solo se acepta STDIN_FILENO.
+ * @param[out] buf Destino de los datos.
+ * @param[in] len Tamaño de buf.
+ * @return Bytes leídos, -1 en error o UART_RX_REINTENTAR (uso interno del kernel)
+ *         si la tarea quedó bloqueada.
+ */
+int sys_read(uint32_t fd, uint8_t *buf, uint32_t len);
+
+/*!
+ * @brief Imprime por UART los contadores de recepción.
+ *
+ * @return None
+ */
+void uart_rx_report(void);
+
+#endif // UART_RX_H_
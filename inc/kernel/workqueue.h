@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    workqueue.h
+ * @brief   Declaración de la cola de trabajo diferido y de la tarea que la atiende
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef WORKQUEUE_H_
+#define WORKQUEUE_H_
+
+#include <stdint.h>
+
+/*!
+ * @brief Trabajo diferido. Es intrusivo: quien encola es dueño del work_t y no hace falta memoria dinámica.
+ */
+typedef struct work_s
+{
+    void (*funcion)(void *arg);
+    void *arg;
+    struct work_s *sig;
+    volatile uint8_t pendiente; // Ya está en la cola: encolarlo de nuevo no hace nada
+} work_t;
+
+#define WORK_INIT(f, a) {(f), (a), NULL, 0}
+
+/*!
+ * @brief Encola un trabajo para la tarea worker. Se puede llamar desde IRQ, softirq o tarea.
+ *
+ * @param[in] w Trabajo a encolar.
+ * @return 1 si se encoló, 0 si ya estaba pendiente.
+ */
+uint32_t workqueue_encolar(work_t *w);
+
+/*!
+ * @brief Implementación de la llamada al sistema con la que espera la tarea worker.
+ *
+ * @return 1 si la worker quedó bloqueada porque la cola está vacía, 0 si hay trabajo.
+ */
+uint32_t sys_work_esperar(void);
+
+/*!
+ * @brief Tarea del kernel que corre los trabajos encolados con las IRQ habilitadas.
+ *
+ * @return None
+ */
+void tarea_worker(void);
+
+#endif // WORKQUEUE_H_
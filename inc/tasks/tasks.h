@@ -31,9 +31,26 @@
 
 #include "defines.h"
 
+// FIBRAS_DEMO=<n>: la tarea 3 corre n fibras que hacen E/S bloqueante por el anillo (make FIBRAS=<n>)
+#ifdef FIBRAS_DEMO
+#define FIBRAS_DEMO_VUELTAS 3U
+#define FIBRAS_DEMO_PILA 512U // Pila de cada fibra con su descriptor, desde la arena de la tarea
+#endif
+
 void tarea_idle(void);
 void tarea1(void);
 void tarea2(void);
 void tarea3(void);
 
+#if STRESS_TAREAS > 0
+extern volatile uint32_t stress_items[STRESS_TAREAS];
+
+/*!
+ * @brief Tarea del generador de carga: repite items de cálculo, llamadas al sistema, salida y sueños.
+ *
+ * @return None
+ */
+void tarea_stress(void);
+#endif
+
 #endif // TASKS_H_
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    anillo.h
+ * @brief   Interfaz de usuario de los anillos de envío y de completado
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef USER_ANILLO_H_
+#define USER_ANILLO_H_
+
+#include <stdint.h>
+
+/*!
+ * @brief Funcion que registra los anillos de la tarea en el kernel y los deja vacíos.
+ *
+ * @param[in] a Anillos de la tarea, en un bloque de ANILLO_TAM(sq_cant) bytes que tiene que seguir
+ *              existiendo mientras corra.
+ * @param[in] sq_cant Entradas del anillo de envío; potencia de 2 hasta ANILLO_SQ_MAX.
+ * 
+ * @return	  Devuelve 0 o -1 en error.
+ */
+int anillo_registrar(anillo_t *a, uint32_t sq_cant);
+
+/*!
+ * @brief Funcion que reserva los anillos en la arena de heap de la tarea y los registra.
+ *
+ * @param[in] sq_cant Entradas del anillo de envío; potencia de 2 hasta ANILLO_SQ_MAX.
+ * 
+ * @return	  Devuelve los anillos o NULL si no entran en la arena o el kernel los rechazó.
+ */
+anillo_t *anillo_crear(uint32_t sq_cant);
+
+/*!
+ * @brief Funcion que reserva el próximo lugar del anillo de envío, sin publicarlo.
+ *
+ * @param[in] a Anillos de la tarea.
+ * 
+ * @return	  Devuelve la entrada a completar o NULL si el anillo está lleno.
+ */
+anillo_sqe_t *anillo_sqe(anillo_t *a);
+
+/*!
+ * @brief Funcion que publica al kernel las entradas reservadas con anillo_sqe. Son solo escrituras a memoria.
+ *
+ * @param[in] a Anillos de la tarea.
+ * 
+ * @return	  None
+ */
+void anillo_publicar(anillo_t *a);
+
+/*!
+ * @brief Funcion que pide al kernel que procese ya todo lo publicado, con una sola llamada al sistema.
+ *
+ * @param[in] esperar Distinto de 0 para dormir hasta que haya al menos una completion.
+ * 
+ * @return	  Devuelve la cantidad de envíos procesados o -1 en error.
+ */
+int anillo_enter(uint32_t esperar);
+
+/*!
+ * @brief Funcion que saca la próxima completion, si hay.
+ *
+ * @param[in] a Anillos de la tarea.
+ * @param[out] cqe Completion leída.
+ * 
+ * @return	  Devuelve 1 si leyó una completion o 0 si el anillo de completado está vacío.
+ */
+int anillo_cqe(anillo_t *a, anillo_cqe_t *cqe);
+
+#endif // USER_ANILLO_H_
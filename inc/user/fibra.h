@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    fibra.h
+ * @brief   Declaración de las fibras de usuario: concurrencia cooperativa dentro de una tarea
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef USER_FIBRA_H_
+#define USER_FIBRA_H_
+
+#include <stdint.h>
+
+// Envíos del anillo de las fibras: con 64 el bloque ocupa 2 KB de la arena (ANILLO_TAM)
+#ifndef FIBRAS_ANILLO_CANT
+#define FIBRAS_ANILLO_CANT 64U
+#endif
+
+// Pila de cada fibra, con su descriptor incluido. Sale de la arena de heap de la tarea
+#ifndef FIBRA_PILA
+#define FIBRA_PILA 256U
+#endif
+#define FIBRA_PILA_MIN 128U
+#define FIBRA_CANARIO 0xF1B7A5EDU
+#define FIBRA_FRAME_PALABRAS 9U // R4-R11 y PC, como los apila fibra_cambiar
+
+#define FIBRAS_UD_TICK 0U // user_data del timer del planificador; las fibras usan su dirección
+
+typedef enum
+{
+    FIBRA_LISTA = 0,
+    FIBRA_BLOQUEADA, // Esperando una completion del anillo
+    FIBRA_DORMIDA,
+    FIBRA_TERMINADA,
+} fibra_estado_t;
+
+/*!
+ * @brief Descriptor de una fibra. Va al principio de su bloque y la pila crece hacia él desde el final.
+ */
+typedef struct fibra_s
+{
+    uint32_t *sp;           // SP guardado mientras no corre
+    struct fibra_s *sig;    // Cola de listas o lista de dormidas
+    void (*funcion)(void *);
+    void *arg;
+    uint32_t despertar;     // Tick de las fibras en el que vence fibra_dormir
+    int32_t res;            // Resultado de la última fibra_io
+    uint32_t estado;
+    uint32_t canario;       // Última palabra antes de la pila: detecta desbordes
+} fibra_t;
+
+typedef struct
+{
+    uint32_t cambios;
+    uint32_t creadas;
+    uint32_t esperas; // Veces que la tarea entera durmió porque todas las fibras esperaban
+} fibras_stats_t;
+
+/*!
+ * @brief Planificador de fibras de una tarea. Lo usa solo la tarea dueña: no hay locks.
+ */
+typedef struct
+{
+    fibra_t *actual;         // NULL mientras corre el contexto principal (fibras_correr)
+    fibra_t *listas;         // Cola FIFO de fibras listas
+    fibra_t *listas_fin;
+    fibra_t *dormidas;       // Ordenada por despertar
+    fibra_t *a_liberar;      // Terminó y todavía corría sobre su pila: se libera en el próximo cambio
+    uint32_t *sp_principal;
+    anillo_t *anillo;        // NULL: las fibras solo pueden ceder
+    uint32_t ticks;          // Avanza con el timer del anillo mientras haya fibras dormidas
+    uint32_t vivas;
+    uint32_t en_vuelo;       // Envíos sin completion, incluido el timer
+    uint8_t timer_armado;
+    fibras_stats_t stats;
+} fibras_t;
+
+/*!
+ * @brief Funcion que inicializa el planificador de fibras de la tarea actual.
+ *
+ * @param[in] f Planificador; tiene que seguir existiendo mientras haya fibras.
+ * @param[in] anillo_cant Envíos del anillo para la E/S de las fibras (p. ej. FIBRAS_ANILLO_CANT), que se
+ *                        reserva en la arena y se registra acá. Con 0 no hay anillo y fibra_dormir solo cede.
+ * 
+ * @return	  Devuelve 0 o -1 si el anillo no entra en la arena o no se pudo registrar.
+ */
+int fibras_init(fibras_t *f, uint32_t anillo_cant);
+
+/*!
+ * @brief Funcion que crea una fibra y la deja lista. Empieza a correr dentro de fibras_correr.
+ *
+ * @param[in] funcion Cuerpo de la fibra; al volver la fibra termina.
+ * @param[in] arg Argumento de funcion.
+ * @param[in] pila Bytes de pila incluido el descriptor; 0 para FIBRA_PILA.
+ * 
+ * @return	  Devuelve la fibra o NULL si no hay lugar en la arena.
+ */
+fibra_t *fibra_crear(void (*funcion)(void *), void *arg, uint32_t pila);
+
+/*!
+ * @brief Funcion que corre las fibras de la tarea hasta que terminan todas. Cuando todas esperan
+ *        E/S, duerme a la tarea en SYS_RING_ENTER hasta la próxima completion.
+ *
+ * @return	  None
+ */
+void fibras_correr(void);
+
+/*!
+ * @brief Funcion que pasa la CPU a la próxima fibra lista, si hay. No entra al kernel.
+ *
+ * @return	  None
+ */
+void fibra_ceder(void);
+
+/*!
+ * @brief Funcion que duerme a la fibra actual una cantidad de ticks. Las demás siguen corriendo.
+ *
+ * @param[in] ticks Ticks a dormir.
+ * 
+ * @return	  None
+ */
+void fibra_dormir(uint32_t ticks);
+
+/*!
+ * @brief Funcion que envía un pedido por el anillo y bloquea solo a la fibra actual hasta su completion.
+ *
+ * @param[in] op Operación (ANILLO_OP_*).
+ * @param[in] arg0 Primer argumento del pedido.
+ * @param[in] arg1 Segundo argumento del pedido.
+ * 
+ * @return	  Devuelve el resultado de la completion, o -1 fuera de una fibra o sin anillo.
+ */
+int32_t fibra_io(uint32_t op, uint32_t arg0, uint32_t arg1);
+
+/*!
+ * @brief Funcion que guarda el contexto en *guardar y sigue en el de nuevo_sp (fibra.s).
+ *
+ * @param[out] guardar Dónde queda el SP del que sale.
+ * @param[in] nuevo_sp SP guardado del que entra.
+ * 
+ * @return	  None
+ */
+void fibra_cambiar(uint32_t **guardar, uint32_t *nuevo_sp);
+
+#endif // USER_FIBRA_H_
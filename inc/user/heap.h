@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    heap.h
+ * @brief   Declaración del heap de usuario: una arena por tarea con clases de tamaño
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#ifndef USER_HEAP_H_
+#define USER_HEAP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#ifdef NEWLIB
+#include <reent.h>
+#ifdef SMP
+#error "NEWLIB no admite SMP: _impure_ptr es uno solo para todas las CPUs"
+#endif
+#ifdef AISLAMIENTO
+#error "NEWLIB no admite AISLAMIENTO: sus datos (_impure_ptr, locale) no están en .usuario_data"
+#endif
+#endif
+
+// Tamaño de la arena de cada tarea, con la cabecera incluida (make HEAP_TAREA=<bytes>)
+#ifndef HEAP_TAREA_TAM
+#define HEAP_TAREA_TAM (16U * 1024U)
+#endif
+
+#define HEAP_CANT_CLASES 8U  // Clases de 16 a 2048 bytes, en potencias de 2
+#define HEAP_CLASE_MIN_LOG2 4U
+#define HEAP_CLASE_GRANDE HEAP_CANT_CLASES // Marca de los bloques que no entran en ninguna clase
+#define HEAP_ALINEACION 8U
+
+/*!
+ * @brief Cabecera de cada bloque. Queda justo antes del puntero que se entrega.
+ */
+typedef struct heap_bloque_s
+{
+    uint32_t clase; // Clase de tamaño, o HEAP_CLASE_GRANDE
+    uint32_t tam;   // Tamaño útil del bloque
+} heap_bloque_t;
+
+typedef struct
+{
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t fallos; // Sin lugar en la arena
+    uint32_t en_uso; // Bytes entregados y no liberados
+} heap_stats_t;
+
+/*!
+ * @brief Arena de una tarea, al principio de su región. Solo la usa la tarea dueña: no hay locks.
+ */
+typedef struct
+{
+    uint8_t *brk;                       // Fin del espacio entregado por heap_sbrk
+    uint8_t *fin;                       // Fin de la región de la tarea
+    void *libres[HEAP_CANT_CLASES];     // Listas libres intrusivas, una por clase
+    void *grandes;                      // Bloques grandes liberados (primer ajuste)
+    heap_stats_t stats;
+    void *fibras;                       // Planificador de fibras de la tarea (fibras_init), o NULL
+#ifdef NEWLIB
+    struct _reent reent;                // Estado de la newlib de la tarea (errno, stdio)
+#endif
+} heap_arena_t;
+
+/*!
+ * @brief Inicializa la arena al principio de una región. La llama el kernel al crear la tarea.
+ *
+ * @param[in] region Región de la tarea, alineada a 8.
+ * @param[in] tam Tamaño de la región.
+ * @return La arena, para guardar en el TCB.
+ */
+heap_arena_t *heap_arena_init(void *region, uint32_t tam);
+
+/*!
+ * @brief Funcion que devuelve la arena de la tarea actual. El kernel la deja en TPIDRURO en cada
+ *        cambio de contexto, así que se lee con una instrucción y sin llamada al sistema.
+ *
+ * @return	  Devuelve la arena o NULL si la tarea no tiene.
+ */
+heap_arena_t *heap_arena_actual(void);
+
+/*!
+ * @brief Funcion que corre el break de la arena de la tarea actual.
+ *
+ * @param[in] incr Bytes a agregar (o quitar, si es negativo).
+ * 
+ * @return	  Devuelve el break anterior o (void *)-1 si no hay lugar.
+ */
+void *heap_sbrk(ptrdiff_t incr);
+
+/*!
+ * @brief Funcion que reserva memoria de la arena de la tarea actual.
+ *
+ * @param[in] tam Bytes pedidos.
+ * 
+ * @return	  Devuelve el bloque, alineado a 8, o NULL si no hay lugar.
+ */
+void *heap_alloc(size_t tam);
+
+/*!
+ * @brief Funcion que devuelve un bloque a la arena de la tarea actual.
+ *
+ * @param[in] ptr Bloque obtenido con heap_alloc; NULL no hace nada.
+ * 
+ * @return	  None
+ */
+void heap_free(void *ptr);
+
+/*!
+ * @brief Funcion que devuelve el tamaño útil de un bloque (el de su clase, no el pedido).
+ *
+ * @param[in] ptr Bloque obtenido con heap_alloc.
+ * 
+ * @return	  Devuelve los bytes utilizables o 0 si ptr es NULL.
+ */
+size_t heap_tam_util(void *ptr);
+
+#endif // USER_HEAP_H_
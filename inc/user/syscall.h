@@ -40,6 +40,110 @@
  */
 int my_printf(const char *buf);
 
+/*!
+ * @brief Funcion que imprime un buffer de largo explícito en la salida estándar.
+ *
+ * @param[in] buf Buffer de datos a escribir; puede no estar terminado en '\0'.
+ * @param[in] len Cantidad de bytes a escribir.
+ * 
+ * @return	  Devuelve la cantidad de bytes escritos o -1 en error.
+ */
 int my_printf_len(const char *buf, size_t len);
 
+/*!
+ * @brief Funcion que asigna a la tarea un canal de la consola (UART0 a UART3) para my_printf.
+ *
+ * @param[in] canal Canal; sin CONSOLA solo existe la UART0 y la llamada falla.
+ * 
+ * @return	  Devuelve 0 o -1 en error.
+ */
+int my_consola(unsigned int canal);
+
+/*!
+ * @brief Funcion que envía un registro de la bitácora binaria. Se usa a través de BITACORA_ERROR, BITACORA_INFO, etc.
+ *
+ * @param[in] cabecera Cabecera armada por la macro: nivel, índice del formato y cantidad de argumentos.
+ * 
+ * @return	  Devuelve la cantidad de bytes enviados o -1 en error.
+ */
+int my_bitacora(unsigned int cabecera, ...);
+
+/*!
+ * @brief Funcion que lee de la entrada estándar (UART0). Duerme a la tarea hasta que haya datos.
+ *
+ * @param[in] fd Descriptor; solo se acepta 0.
+ * @param[out] buf Destino de los datos.
+ * @param[in] len Tamaño de buf.
+ * 
+ * @return	  Devuelve la cantidad de bytes leídos (al menos 1) o -1 en error.
+ */
+int my_read(unsigned int fd, void *buf, unsigned int len);
+
+/*!
+ * @brief Funcion que consulta el uso máximo medido de una pila de una tarea.
+ *
+ * @param[in] task_id Tarea a consultar.
+ * @param[in] modo Pila a consultar: 0 = kernel, 1 = SYS.
+ * 
+ * @return	  Devuelve la cantidad de bytes usados o -1 en error.
+ */
+int stack_usage(unsigned int task_id, unsigned int modo);
+
+/*!
+ * @brief Funcion que lee un reloj del sistema mediante SVC.
+ *
+ * @param[in] clk_id Reloj a leer (CLOCK_MONOTONIC).
+ * @param[out] ts Tiempo leído.
+ * 
+ * @return	  Devuelve 0 o -1 en error.
+ */
+int my_clock_gettime(unsigned int clk_id, timespec_t *ts);
+
+/*!
+ * @brief Funcion que lee el tiempo monotónico desde la página compartida, sin SVC.
+ *
+ * @param[out] ts Tiempo leído.
+ * 
+ * @return	  None
+ */
+void my_clock_gettime_rapido(timespec_t *ts);
+
+/*!
+ * @brief Funcion que marca el fin del trabajo periódico de una tarea de tiempo real
+ *        y espera hasta su próxima activación. En tareas sin parámetros de tiempo real vuelve enseguida.
+ *
+ * @return	  None
+ */
+void my_rt_esperar_periodo(void);
+
+/*!
+ * @brief Funcion que cede la CPU a la próxima tarea lista sin esperar al fin del quantum.
+ *
+ * @return	  None
+ */
+void my_yield(void);
+
+/*!
+ * @brief Funcion que devuelve el identificador de la tarea que llama.
+ *
+ * @return	  Devuelve el task_id de la tarea.
+ */
+int my_getpid(void);
+
+/*!
+ * @brief Funcion que duerme a la tarea durante una cantidad de ticks del sistema.
+ *
+ * @param[in] ticks Ticks a dormir; con 0 vuelve enseguida.
+ * 
+ * @return	  None
+ */
+void my_dormir(unsigned int ticks);
+
+/*!
+ * @brief Funcion que termina la tarea que llama. El kernel no la vuelve a planificar.
+ *
+ * @return	  No vuelve.
+ */
+void my_exit(void) __attribute__((noreturn));
+
 #endif /* USER_SYSCALL_H_ */
\ No newline at end of file
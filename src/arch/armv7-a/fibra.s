@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @file    fibra.s
+ * @brief   Cambio de contexto entre fibras de usuario: solo los registros que preserva el llamado (AAPCS)
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+.extern fibra_entrada
+
+.global fibra_cambiar
+.global fibra_arranque
+// Símbolos de función: con THUMB el linker convierte los BL de las fibras en BLX a este código ARM
+.type fibra_cambiar, %function
+.type fibra_arranque, %function
+
+.code 32
+.section .text
+// R0: dónde guardar el SP de la que sale. R1: SP de la que entra.
+// POP {.., PC} hace interworking, así que sirve igual si las fibras están compiladas como Thumb
+fibra_cambiar:
+    PUSH {R4-R11, LR}
+    STR SP, [R0]
+    MOV SP, R1
+    POP {R4-R11, PC}
+// Primera vez que corre una fibra: fibra_crear deja la fibra en R4 del frame inicial
+fibra_arranque:
+    MOV R0, R4
+    BLX fibra_entrada
+    B .
+.end
@@ -32,6 +32,16 @@
 .extern C_IRQ_handler
 .extern C_SVC_handler
 .extern identify_IRQ
+.extern irq_salida
+.extern scheduler_fin_cambio
+.extern softirq_ejecutar
+.extern softirq_pila
+.extern C_abort_handler
+
+.equ MODE_SVC, 0x13
+.equ SYS_EXIT, 1
+.equ SVC_NUM_EN_R12, 0xFF
+.equ PSR_T, 0x20
 
 .global undef_handler
 .global svc_handler
@@ -40,7 +50,12 @@
 .global reserved_handler
 .global irq_handler
 .global fiq_handler
+.global usuario_abortar
 
+// Frame de una excepción, en la pila de kernel (SVC) de la tarea interrumpida, de abajo hacia arriba:
+//   relleno, LR de SVC | frame[0] = &frame[2], frame[1] = SPSR, frame[2..14] = R0-R12, frame[15] = PC de retorno
+// C recibe &frame[0] y devuelve el frame a restaurar: el mismo, o el de la tarea entrante en su propia pila.
+// Cambiar de tarea es solo cambiar de frame; el SP de SVC sale de su dirección.
 .code 32
 .section .text
 undef_handler:
@@ -50,36 +65,105 @@ svc_handler:
     MOV R8, SP
     MRS R9, SPSR
     PUSH {R8, R9}
-    MOV R1, SP
+    SUB SP, SP, #8
+    STR LR, [SP, #4]
+    ADD R1, SP, #8
+// Las excepciones entran en estado ARM; SPSR.T dice en qué estado estaba la tarea al llamar
+    TST R9, #PSR_T
+    BNE svc_thumb
     LDR R0,[LR,#-4]
     BIC R0,R0,#0xFF000000
+svc_decodificado:
     BLX C_SVC_handler
-    MOV SP, R0
-    POP {R0, R1}
-    MOV SP, R0
-    MSR SPSR, R1
-    POP {R0-R12, LR}
-    MOVS PC, LR
+    SUB SP, R0, #8
+    BLX scheduler_fin_cambio
+    B frame_restaurar
+// SVC de 16 bits: el número está en el byte bajo, o en R12 si es SVC_NUM_EN_R12
+svc_thumb:
+    LDRH R0, [LR, #-2]
+    AND R0, R0, #0xFF
+    CMP R0, #SVC_NUM_EN_R12
+    MOVEQ R0, R12
+    B svc_decodificado
+// Con AISLAMIENTO una falla de una tarea de usuario la termina: se vuelve a modo usuario en usuario_abortar.
+// Una falla del kernel se reporta y detiene la CPU.
 pabt_handler:
+.ifdef AISLAMIENTO
+    SUB LR, LR, #4
+    PUSH {R0-R3, R12, LR}
+    MOV R0, #1
+    B abort_comun
+.else
     B .
+.endif
 dabt_handler:
+.ifdef AISLAMIENTO
+    SUB LR, LR, #8
+    PUSH {R0-R3, R12, LR}
+    MOV R0, #0
+abort_comun:
+    MRS R1, SPSR
+    MOV R2, LR
+    BLX C_abort_handler
+    STR R0, [SP, #20]
+    MRS R1, SPSR
+    BIC R1, R1, #PSR_T         // usuario_abortar es código ARM aunque la tarea fuera Thumb
+    MSR SPSR_fsxc, R1
+    POP {R0-R3, R12, LR}
+    MOVS PC, LR
+.else
     B .
+.endif
+// Salida de una tarea que falló: no usa la pila, que puede ser justamente la que no está mapeada
+usuario_abortar:
+    SVC #SYS_EXIT
+    B usuario_abortar
 reserved_handler:
     B .
+// La pila IRQ es compartida por CPU y solo guarda R0, R1 y el PC de retorno de paso, debajo del tope
+// y sin mover SP_irq: el frame se arma directamente en la pila de kernel de la tarea interrumpida.
 irq_handler:
     SUB LR, LR, #4
-    PUSH {R0-R12, LR}
-    MOV R0, SP
+    STMDB SP, {R0, R1, LR}
     MRS R1, SPSR
-    PUSH {R0, R1}
     MOV R0, SP
+    CPS #MODE_SVC
+    SUB SP, SP, #72
+    STR LR, [SP, #4]           // LR de SVC: vivo si la IRQ cortó una llamada al sistema o una softirq
+    STR R1, [SP, #12]
+    ADD R1, SP, #16
+    STR R1, [SP, #8]
+    ADD R1, SP, #24
+    STMIA R1, {R2-R12}
+    LDMDB R0, {R1-R3}
+    STR R1, [SP, #16]
+    STR R2, [SP, #20]
+    STR R3, [SP, #68]
+    ADD R0, SP, #8
     BLX C_IRQ_handler
+    SUB SP, R0, #8
+// Recién ahora la CPU dejó la pila de la tarea saliente: se puede encolar y otra CPU la puede robar
+    BLX scheduler_fin_cambio
+// Mitades inferiores: sobre la pila de softirqs de la CPU y con las IRQ habilitadas, así la pila de
+// kernel de la tarea solo guarda frames. Una IRQ anidada apila su frame en la pila de softirqs y no
+// cambia de tarea mientras corren, así que esa pila no queda a medias en ninguna tarea.
+    BLX irq_salida
+    CMP R0, #0
+    BEQ frame_restaurar
+    BLX softirq_pila
+    MOV R4, SP                 // R4 se preserva a través de las llamadas a C
     MOV SP, R0
-    POP {R0, R1}
-    MOV SP, R0
-    MSR SPSR, R1
-    POP {R0-R12, LR}
-    MOVS PC, LR
+    CPSIE i
+    BLX softirq_ejecutar
+    CPSID i
+    MOV SP, R4
+// SP apunta al relleno debajo del frame a restaurar
+frame_restaurar:
+    LDR LR, [SP, #4]
+    LDR R1, [SP, #12]
+    MSR SPSR_fsxc, R1
+    ADD SP, SP, #16
+    LDMIA SP!, {R0-R12, PC}^
 fiq_handler:
     B .
 .end
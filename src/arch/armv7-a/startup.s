@@ -26,7 +26,15 @@
  * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
  * @date    2025-06-10
  */
-.equ CANT_TABLE, 16
+// Indices de las fases de arranque (ver boot_phase_t en boot_prof.h)
+.equ BOOT_PHASE_RESET, 0
+.equ BOOT_PHASE_STACKS, 1
+.equ BOOT_PHASE_VECTORS, 2
+
+// Bits de CP15
+.equ SCTLR_V, 0x2000        // SCTLR.V: vectores altos en 0xFFFF0000
+.equ PMCR_E_C, 0x5          // PMCR.E y PMCR.C: habilita y reinicia el contador de ciclos
+.equ PMCNTEN_CCNT, 0x80000000
 
 // Definiciones de modos de CPU
 .equ MODE_USER, 16
@@ -59,14 +67,33 @@
 .extern board_init
 .extern halt_cpu
 
+//Externs del perfilado de arranque
+.extern boot_prof_ts
+
+//Externs del arranque SMP
+.extern smp_entrada
+.extern smp_secundario_init
+.extern _cpu_stacks_start_
+.extern _cpu_stack_block_size_
+
 .global _start
+.global _start_secundario
 
 .section .data
 string: .asciz "Prueba de svcall\n"
 
+// Guarda el contador de ciclos en boot_prof_ts[fase]. Usa R3 y R4, no necesita pila.
+.macro BOOT_MARK fase
+    MRC p15, 0, R3, c9, c13, 0
+    LDR R4, =boot_prof_ts
+    STR R3, [R4, #(\fase * 4)]
+.endm
+
 .code 32
 .section .text
 
+// VBAR exige 32 bytes de alineación; se alinea a 64 para que la tabla ocupe una sola línea de cache
+.balign 64
 tabla:
     LDR PC, lit_reset_vector
     LDR PC, lit_undef_handler
@@ -87,6 +114,18 @@ lit_irq_handler:     .word irq_handler
 lit_fiq_handler:     .word fiq_handler
 
 _start:
+.ifdef SMP
+    MRC p15, 0, R0, c0, c0, 5  // MPIDR: solo la CPU0 sigue con el arranque
+    ANDS R0, R0, #3
+    BNE smp_pen
+.endif
+    MRC p15, 0, R0, c9, c12, 0 // Habilita el contador de ciclos de la PMU para perfilar el arranque
+    ORR R0, R0, #PMCR_E_C
+    MCR p15, 0, R0, c9, c12, 0
+    LDR R0, =PMCNTEN_CCNT
+    MCR p15, 0, R0, c9, c12, 1
+    BOOT_MARK BOOT_PHASE_RESET
+
     CPSID if, #MODE_IRQ // Modo IRQ con IRQ y FIQ deshabilitados
     LDR SP, =_irq_stack_top_
     CPSID if, #MODE_FIQ //Modo FIQ con IRQ y FIQ deshabilitados
@@ -100,24 +139,82 @@ _start:
     CPSID if, #MODE_SYS // Modo System con IRQ y FIQ deshabilitados
     LDR SP, =_c_stack_top_
     CPS #MODE_SVC // Cambia a modo SVC
+    BOOT_MARK BOOT_PHASE_STACKS
 
-    LDR R0, =tabla         
-    LDR R1, =0x00000000    
-    MOV R2, #CANT_TABLE           
-
-// Copia la tabla de vectores de los handlers de interrupciones a la dirección 0x00000000
-copy_tabla:
-    LDR R3, [R0], #4
-    STR R3, [R1], #4
-    SUBS R2, R2, #1
-    BNE copy_tabla
+// Apunta VBAR a la tabla de vectores en .text, sin copiarla a 0x00000000
+set_vbar:
+    LDR R0, =tabla
+    MCR p15, 0, R0, c12, c0, 0 // VBAR = tabla
+    MRC p15, 0, R0, c1, c0, 0
+    BIC R0, R0, #SCTLR_V       // Vectores bajos: se usa VBAR
+    MCR p15, 0, R0, c1, c0, 0
+    ISB
+    BOOT_MARK BOOT_PHASE_VECTORS
 
 init_board:
     BLX board_init // Llama a la función de inicialización de la placa
     CPSIE if // Habilita interrupciones 
 
 _halt:
-    B halt_cpu 
+    BLX halt_cpu               // BLX: con THUMB halt_cpu es código Thumb
 //    WFI
 //    B _halt
+
+.ifdef SMP
+// Holding pen: las CPUs secundarias esperan a que la CPU0 publique la dirección de arranque
+smp_pen:
+    WFE
+    LDR R1, =smp_entrada
+    LDR R1, [R1]
+    CMP R1, #0
+    BEQ smp_pen
+    BX R1
+
+// Arranque de las CPUs secundarias: cada una usa su bloque de _cpu_stacks_start_
+_start_secundario:
+    MRC p15, 0, R0, c0, c0, 5
+    AND R0, R0, #3             // R0 = número de CPU (1 a 3)
+    SUB R0, R0, #1
+    LDR R1, =_cpu_stack_block_size_
+    MUL R2, R0, R1
+    LDR R1, =_cpu_stacks_start_
+    ADD R2, R2, R1             // R2 = base del bloque de pilas de esta CPU
+
+    LDR R1, =IRQ_STACK_SIZE
+    ADD R2, R2, R1
+    CPSID if, #MODE_IRQ
+    MOV SP, R2
+    LDR R1, =FIQ_STACK_SIZE
+    ADD R2, R2, R1
+    CPSID if, #MODE_FIQ
+    MOV SP, R2
+    LDR R1, =SVC_STACK_SIZE
+    ADD R2, R2, R1
+    CPSID if, #MODE_SVC
+    MOV SP, R2
+    LDR R1, =UND_STACK_SIZE
+    ADD R2, R2, R1
+    CPSID if, #MODE_UND
+    MOV SP, R2
+    LDR R1, =ABT_STACK_SIZE
+    ADD R2, R2, R1
+    CPSID if, #MODE_ABT
+    MOV SP, R2
+    LDR R1, =C_STACK_SIZE
+    ADD R2, R2, R1
+    CPSID if, #MODE_SYS
+    MOV SP, R2
+    CPS #MODE_SVC
+
+    LDR R0, =tabla             // VBAR y SCTLR.V son propios de cada CPU
+    MCR p15, 0, R0, c12, c0, 0
+    MRC p15, 0, R0, c1, c0, 0
+    BIC R0, R0, #SCTLR_V
+    MCR p15, 0, R0, c1, c0, 0
+    ISB
+
+    BLX smp_secundario_init    // Interfaz de CPU del GIC y timer privado
+    CPSIE if
+    BLX halt_cpu               // Contexto idle de la CPU hasta el primer tick
+.endif
 .end
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    bench.c
+ * @brief   Imagen de benchmark: ciclos por función del kernel medidos con la PMU
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+extern tcb_context_t tcb_tareas;
+
+__attribute__((section(".tcb_data"))) static spinlock_t bench_lock = SPINLOCK_INIT;
+__attribute__((section(".tcb_data"))) static timespec_t bench_ts;
+__attribute__((section(".tcb_data"))) static fibras_t bench_fibras;
+__attribute__((section(".tcb_data"))) static fibra_t *bench_fibra_eco;
+__attribute__((section(".tcb_data"))) static uint32_t *bench_sp;
+
+SECCION_TEXT static void bench_vacio(void)
+{
+    NOP;
+}
+
+SECCION_TEXT static void bench_kmalloc(void)
+{
+    kfree(kmalloc(64));
+}
+
+SECCION_TEXT static void bench_malloc_chico(void)
+{
+    heap_free(heap_alloc(32));
+}
+
+SECCION_TEXT static void bench_malloc_grande(void)
+{
+    heap_free(heap_alloc(1024));
+}
+
+// Fibra que devuelve la CPU apenas la recibe: cada caso es un cambio de ida y uno de vuelta
+SECCION_TEXT static void bench_fibra_cuerpo(void *arg)
+{
+    (void)arg;
+    while (1)
+    {
+        fibra_cambiar(&bench_fibra_eco->sp, bench_sp);
+    }
+}
+
+SECCION_TEXT static void bench_fibra(void)
+{
+    fibra_cambiar(&bench_sp, bench_fibra_eco->sp);
+}
+
+SECCION_TEXT static void bench_spinlock(void)
+{
+    spin_unlock_irqrestore(&bench_lock, spin_lock_irqsave(&bench_lock));
+}
+
+SECCION_TEXT static void bench_clock_ns(void)
+{
+    (void)clock_ns();
+}
+
+SECCION_TEXT static void bench_clock_gettime(void)
+{
+    (void)sys_clock_gettime(CLOCK_MONOTONIC, &bench_ts);
+}
+
+SECCION_TEXT static void bench_cpu_id(void)
+{
+    (void)cpu_id();
+}
+
+SECCION_TEXT static void bench_scheduler_actual(void)
+{
+    (void)scheduler_actual();
+}
+
+SECCION_TEXT static void bench_stack_scan(void)
+{
+    stack_scan_step();
+}
+
+#ifdef AISLAMIENTO
+SECCION_TEXT static void bench_espacios(void)
+{
+    // Ida y vuelta: espacio de la tarea 1 y de nuevo el del kernel
+    espacios_activar(&tcb_tareas.tareas[TASK_1]);
+    espacios_activar(&tcb_tareas.tareas[TASK_IDLE]);
+}
+#endif
+
+#ifdef SCHED_RT
+SECCION_TEXT static void bench_rt_elegir(void)
+{
+    (void)rt_elegir();
+}
+#endif
+
+static const bench_caso_t bench_casos[] = {
+    {"kmalloc+kfree(64)  ", bench_kmalloc},
+    {"malloc+free(32)    ", bench_malloc_chico},
+    {"malloc+free(1024)  ", bench_malloc_grande},
+    {"fibra_cambiar x2   ", bench_fibra},
+    {"spinlock irqsave   ", bench_spinlock},
+    {"clock_ns           ", bench_clock_ns},
+    {"sys_clock_gettime  ", bench_clock_gettime},
+    {"cpu_id             ", bench_cpu_id},
+    {"scheduler_actual   ", bench_scheduler_actual},
+    {"stack_scan_step    ", bench_stack_scan},
+#ifdef AISLAMIENTO
+    {"espacios_activar x2", bench_espacios},
+#endif
+#ifdef SCHED_RT
+    {"rt_elegir          ", bench_rt_elegir},
+#endif
+};
+
+#define BENCH_CANT_CASOS (sizeof(bench_casos) / sizeof(bench_casos[0]))
+
+SECCION_TEXT static void bench_medir(void (*funcion)(void), uint32_t *min, uint32_t *prom)
+{
+    uint32_t i = 0;
+    uint32_t inicio;
+    uint32_t fin;
+    uint32_t suma = 0;
+
+    *min = 0xFFFFFFFFU;
+    for (i = 0; i < BENCH_REPETICIONES; i++)
+    {
+        PMU_READ_CCNT(inicio);
+        funcion();
+        PMU_READ_CCNT(fin);
+        fin -= inicio;
+        suma += fin;
+        if (fin < *min)
+        {
+            *min = fin;
+        }
+    }
+    *prom = suma >> BENCH_REPETICIONES_LOG2;
+}
+
+SECCION_TEXT void bench_run(void)
+{
+    uint32_t i = 0;
+    uint32_t base_min;
+    uint32_t base_prom;
+    uint32_t min;
+    uint32_t prom;
+
+    // El heap de usuario busca la arena en TPIDRURO: se mide con la de la tarea idle, que todavía no corrió
+    scheduler_tls_cargar(&tcb_tareas.tareas[TASK_IDLE]);
+    (void)fibras_init(&bench_fibras, 0);
+    bench_fibra_eco = fibra_crear(bench_fibra_cuerpo, NULL, 0);
+    bench_medir(bench_vacio, &base_min, &base_prom);
+
+    kprint_str("\n[bench] funcion               min     prom  (ciclos, sin la llamada vacía: ");
+    kprint_dec(base_min);
+    kprint_str(")\n");
+    for (i = 0; i < BENCH_CANT_CASOS; i++)
+    {
+        bench_medir(bench_casos[i].funcion, &min, &prom);
+        kprint_str("[bench] ");
+        kprint_str(bench_casos[i].nombre);
+        kprint_dec_ancho((min > base_min) ? (min - base_min) : 0, 8);
+        kprint_str(" ");
+        kprint_dec_ancho((prom > base_min) ? (prom - base_min) : 0, 8);
+        kprint_str("\n");
+    }
+    // La fibra de eco no termina nunca: se devuelve su bloque y la idle arranca sin fibras
+    heap_free(bench_fibra_eco);
+    heap_arena_actual()->fibras = NULL;
+    scheduler_tls_cargar(scheduler_actual());
+}
@@ -28,15 +28,56 @@
  */
 #include "defines.h"
 
-__attribute__((section(".text"))) void board_init(void)
+SECCION_TEXT void board_init(void)
 {
+#ifdef CACHE
+    mmu_init();
+#endif
+#if CACHE_BENCH_TICKS > 0
+    cache_bench_init();
+#endif
+#ifdef SMP
+    // Cortex-A9 MPCore: GIC y timer privado de la CPU0; TIMER0 no se usa como tick
+    mpcore_init();
+    boot_prof_mark(BOOT_PHASE_GIC);
+    mpcore_cpu_init();
+    clock_init();
+    boot_prof_mark(BOOT_PHASE_TIMER);
+#else
     __gic_init();
+    boot_prof_mark(BOOT_PHASE_GIC);
     __timer_init();
+    clock_init();
+#if IRQ_LAT_MUESTRAS > 0
+    irq_lat_init();
+#endif
+    boot_prof_mark(BOOT_PHASE_TIMER);
+#endif
+#ifdef CONSOLA
+    consola_init();
+#else
     __uart_init(0);
+#endif
+    uart_rx_init();
+#ifdef BITACORA
+    bitacora_init();
+#endif
+#ifdef DMA_UART
+    dma_uart_init();
+#endif
+    boot_prof_mark(BOOT_PHASE_UART);
+    kmem_init();
+    anillos_init();
+    boot_prof_mark(BOOT_PHASE_KMEM);
     scheduler_init();
+    boot_prof_mark(BOOT_PHASE_SCHEDULER);
+    smp_boot_secundarios();
+#ifdef BENCH
+    bench_run();
+#endif
 }
 
-__attribute__((section(".text"))) void halt_cpu(void)
+SECCION_TEXT void halt_cpu(void)
 {
     while (1)
     {
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    boot_prof.c
+ * @brief   Implementación de funciones para medir el tiempo de cada fase del arranque
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+// Se escribe desde startup.s antes de inicializar las pilas
+uint32_t boot_prof_ts[BOOT_PHASE_CANT];
+
+static const char *const boot_prof_nombres[BOOT_PHASE_CANT] = {
+    "reset          ",
+    "stacks         ",
+    "vectores       ",
+    "__gic_init     ",
+    "__timer_init   ",
+    "__uart_init    ",
+    "kmem_init      ",
+    "scheduler_init ",
+    "primera tarea  ",
+};
+
+SECCION_TEXT static void boot_prof_report_work(void *arg)
+{
+    (void)arg;
+    boot_prof_report();
+}
+__attribute__((section(".tcb_data"))) static work_t boot_prof_work = WORK_INIT(boot_prof_report_work, NULL);
+
+SECCION_TEXT void boot_prof_mark(boot_phase_t fase)
+{
+    uint32_t ciclos;
+    if (fase < BOOT_PHASE_CANT)
+    {
+        PMU_READ_CCNT(ciclos);
+        boot_prof_ts[fase] = ciclos;
+    }
+}
+
+SECCION_TEXT void boot_prof_report(void)
+{
+    uint32_t i = 0;
+    uint32_t anterior = 0;
+
+    kprint_str("\n[boot] fase              ciclos       delta\n");
+    for (i = 0; i < BOOT_PHASE_CANT; i++)
+    {
+        kprint_str("[boot] ");
+        kprint_str(boot_prof_nombres[i]);
+        kprint_dec_ancho(boot_prof_ts[i], 10);
+        kprint_str("  ");
+        kprint_dec_ancho(boot_prof_ts[i] - anterior, 10);
+        kprint_str("\n");
+        anterior = boot_prof_ts[i];
+    }
+    kprint_str("[boot] tiempo hasta la primera tarea: ");
+    kprint_dec(boot_prof_ts[BOOT_PHASE_FIRST_TASK] - boot_prof_ts[BOOT_PHASE_RESET]);
+    kprint_str(" ciclos\n");
+}
+
+SECCION_TEXT void boot_prof_report_diferido(void)
+{
+    workqueue_encolar(&boot_prof_work);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    cache_bench.c
+ * @brief   Medición de fallos de la cache L1 con la PMU
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+#if CACHE_BENCH_TICKS > 0
+
+__attribute__((section(".tcb_data"))) cache_bench_cpu_t cache_bench_cpus[CANT_CPUS];
+__attribute__((section(".tcb_data"))) static uint8_t cache_bench_reportado;
+
+static const uint32_t cache_bench_eventos[CACHE_EV_CANT] = {
+    PMU_EVT_L1D_REFILL,
+    PMU_EVT_L1D_ACCESS,
+    PMU_EVT_L1I_REFILL,
+    PMU_EVT_INSTR,
+};
+
+SECCION_TEXT static void cache_bench_report_work(void *arg)
+{
+    (void)arg;
+    cache_bench_report();
+}
+__attribute__((section(".tcb_data"))) static work_t cache_bench_work = WORK_INIT(cache_bench_report_work, NULL);
+
+SECCION_TEXT void cache_bench_init(void)
+{
+    uint32_t i = 0;
+    cache_bench_cpu_t *c = &cache_bench_cpus[cpu_id()];
+
+    for (i = 0; i < CACHE_EV_CANT; i++)
+    {
+        pmu_evento_config(i, cache_bench_eventos[i]);
+    }
+    c->ticks = 0;
+    c->terminado = 0;
+    if (cpu_id() == 0)
+    {
+        cache_bench_reportado = 0;
+    }
+}
+
+SECCION_TEXT void cache_bench_tick(void)
+{
+    uint32_t i = 0;
+    uint32_t todas = 1;
+    cache_bench_cpu_t *c = &cache_bench_cpus[cpu_id()];
+
+    if (c->terminado == 0)
+    {
+        c->ticks++;
+        if (c->ticks == CACHE_BENCH_CALENTAMIENTO)
+        {
+            for (i = 0; i < CACHE_EV_CANT; i++)
+            {
+                c->inicio[i] = pmu_evento_leer(i);
+            }
+        }
+        else if (c->ticks == CACHE_BENCH_CALENTAMIENTO + CACHE_BENCH_TICKS)
+        {
+            for (i = 0; i < CACHE_EV_CANT; i++)
+            {
+                c->cuenta[i] = pmu_evento_leer(i) - c->inicio[i];
+            }
+            c->terminado = 1;
+        }
+    }
+
+    if (cpu_id() == 0 && cache_bench_reportado == 0)
+    {
+        for (i = 0; i < CANT_CPUS; i++)
+        {
+            if (cache_bench_cpus[i].terminado == 0)
+            {
+                todas = 0;
+            }
+        }
+        if (todas == 1)
+        {
+            cache_bench_reportado = 1;
+            workqueue_encolar(&cache_bench_work);
+        }
+    }
+}
+
+// num * escala / den en 32 bits y sin división de 64: se achican los dos hasta que el producto entre
+SECCION_TEXT static uint32_t cache_bench_proporcion(uint32_t num, uint32_t den, uint32_t escala)
+{
+    while (den > 0x7FFFU || num > kdiv(0xFFFFFFFFU, escala))
+    {
+        num >>= 1;
+        den >>= 1;
+    }
+    return (den > 0) ? kdiv(num * escala, den) : 0;
+}
+
+SECCION_TEXT static void cache_bench_centesimos(uint32_t valor)
+{
+    uint32_t enteros = kdiv(valor, 100U);
+    uint32_t resto = valor - enteros * 100U;
+    kprint_dec(enteros);
+    kprint_str(resto < 10U ? ".0" : ".");
+    kprint_dec(resto);
+}
+
+SECCION_TEXT void cache_bench_report(void)
+{
+    uint32_t i = 0;
+    cache_bench_cpu_t *c;
+
+#ifdef CACHE_COLOR
+    kprint_str("[cache] layout: coloreado y alineado a lineas de cache");
+#else
+    kprint_str("[cache] layout: compacto");
+#endif
+    kprint_str(", ventana: ");
+    kprint_dec(CACHE_BENCH_TICKS);
+    kprint_str(" ticks\n");
+
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        c = &cache_bench_cpus[i];
+        kprint_str("[cache] cpu ");
+        kprint_dec(i);
+        kprint_str(" L1D fallos/accesos: ");
+        kprint_dec(c->cuenta[CACHE_EV_L1D_FALLOS]);
+        kprint_str("/");
+        kprint_dec(c->cuenta[CACHE_EV_L1D_ACCESOS]);
+        kprint_str(" (");
+        cache_bench_centesimos(
+            cache_bench_proporcion(c->cuenta[CACHE_EV_L1D_FALLOS], c->cuenta[CACHE_EV_L1D_ACCESOS], 10000U));
+        kprint_str(" %) L1I fallos: ");
+        kprint_dec(c->cuenta[CACHE_EV_L1I_FALLOS]);
+        kprint_str(" (");
+        cache_bench_centesimos(
+            cache_bench_proporcion(c->cuenta[CACHE_EV_L1I_FALLOS], c->cuenta[CACHE_EV_INSTR], 100000U));
+        kprint_str(" cada 1000 instr)\n");
+    }
+}
+
+#endif // CACHE_BENCH_TICKS > 0
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    irq_lat.c
+ * @brief   Medición de latencia y jitter de interrupciones con un SP804 libre
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+__attribute__((section(".tcb_data"))) irq_lat_t irq_lat;
+
+SECCION_TEXT static void irq_lat_report_work(void *arg)
+{
+    (void)arg;
+    irq_lat_report();
+}
+__attribute__((section(".tcb_data"))) static work_t irq_lat_work = WORK_INIT(irq_lat_report_work, NULL);
+
+SECCION_TEXT static uint32_t irq_lat_proximo_periodo(void)
+{
+    // LFSR de Galois de 32 bits
+    uint32_t lsb = irq_lat.semilla & 1U;
+    irq_lat.semilla >>= 1;
+    if (lsb != 0)
+    {
+        irq_lat.semilla ^= 0x80200003U;
+    }
+    return IRQ_LAT_PERIODO_BASE + (irq_lat.semilla & IRQ_LAT_PERIODO_MASCARA);
+}
+
+SECCION_TEXT void irq_lat_init(void)
+{
+    uint32_t i = 0;
+    _timer_t *const TIMER = (_timer_t *)IRQ_LAT_TIMER_ADDR;
+
+    irq_lat.muestras = 0;
+    irq_lat.min = 0xFFFFFFFFU;
+    irq_lat.max = 0;
+    irq_lat.suma = 0;
+    irq_lat.semilla = 0xACE1U;
+    for (i = 0; i < IRQ_LAT_HIST_CANT; i++)
+    {
+        irq_lat.hist[i] = 0;
+    }
+
+    irq_lat.carga = irq_lat_proximo_periodo();
+    TIMER->Timer1Ctrl = 0;
+    TIMER->Timer1IntClr = 1U;
+    TIMER->Timer1Load = irq_lat.carga;
+    TIMER->Timer1Ctrl = SP804_CTRL_ENABLE | SP804_CTRL_PERIODIC | SP804_CTRL_INTEN | SP804_CTRL_32BIT;
+
+    IRQ_LAT_GICD_ISENABLER(GIC_SOURCE_TIMER1 >> 5) = 1U << (GIC_SOURCE_TIMER1 & 0x1FU);
+}
+
+SECCION_TEXT uint32_t irq_lat_entrada(void)
+{
+    _timer_t *const TIMER = (_timer_t *)IRQ_LAT_TIMER_ADDR;
+    return TIMER->Timer1Value;
+}
+
+SECCION_TEXT void irq_lat_muestra(uint32_t valor)
+{
+    uint32_t latencia;
+    _timer_t *const TIMER = (_timer_t *)IRQ_LAT_TIMER_ADDR;
+
+    TIMER->Timer1IntClr = 1U;
+
+    // Al llegar a cero el contador se recargó con la carga vigente: lo que bajó desde ahí es la latencia
+    latencia = irq_lat.carga - valor;
+    irq_lat.muestras++;
+    irq_lat.suma += latencia;
+    if (latencia < irq_lat.min)
+    {
+        irq_lat.min = latencia;
+    }
+    if (latencia > irq_lat.max)
+    {
+        irq_lat.max = latencia;
+    }
+    irq_lat.hist[(latencia < IRQ_LAT_HIST_CANT) ? latencia : (IRQ_LAT_HIST_CANT - 1U)]++;
+
+    if (irq_lat.muestras >= IRQ_LAT_MUESTRAS)
+    {
+        TIMER->Timer1Ctrl = 0;
+        workqueue_encolar(&irq_lat_work);
+    }
+    else
+    {
+        // BGLoad se toma en la próxima recarga sin reiniciar la cuenta en curso
+        irq_lat.carga = irq_lat_proximo_periodo();
+        TIMER->Timer1BGLoad = irq_lat.carga;
+    }
+}
+
+SECCION_TEXT void irq_lat_report(void)
+{
+    uint32_t i = 0;
+    uint32_t acumulado = 0;
+    uint32_t p99 = 0;
+    uint32_t umbral;
+
+    // Percentil 99 sobre el histograma: primera barra que deja atrás el 99% de las muestras
+    umbral = irq_lat.muestras * 99U;
+    for (i = 0; i < IRQ_LAT_HIST_CANT; i++)
+    {
+        acumulado += irq_lat.hist[i];
+        if (acumulado * 100U >= umbral)
+        {
+            p99 = i;
+            break;
+        }
+    }
+
+    kprint_str("\n[irqlat] muestras: ");
+    kprint_dec(irq_lat.muestras);
+    kprint_str("\n[irqlat] min/prom/max/p99 (us): ");
+    kprint_dec(irq_lat.min);
+    kprint_str(" / ");
+    kprint_dec(kdiv(irq_lat.suma, irq_lat.muestras));
+    kprint_str(" / ");
+    kprint_dec(irq_lat.max);
+    kprint_str(" / ");
+    kprint_dec(p99);
+    kprint_str("\n[irqlat] jitter (max - min): ");
+    kprint_dec(irq_lat.max - irq_lat.min);
+    kprint_str(" us\n");
+
+    for (i = 0; i < IRQ_LAT_HIST_CANT; i++)
+    {
+        if (irq_lat.hist[i] != 0)
+        {
+            kprint_str("[irqlat] ");
+            kprint_dec_ancho(i, 3);
+            kprint_str((i == IRQ_LAT_HIST_CANT - 1U) ? "+ us: " : "  us: ");
+            kprint_dec_ancho(irq_lat.hist[i], 8);
+            kprint_str("\n");
+        }
+    }
+}
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    mmu.c
+ * @brief   Mapa plano de la MMU y mantenimiento de caches
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+// TTBR0 exige la tabla alineada a 16 KB; va en public_heap para no agrandar el binario
+__attribute__((section(".mmu_tablas"), aligned(16384))) static uint32_t mmu_tabla[MMU_ENTRADAS];
+#ifdef AISLAMIENTO
+// Tablas de segundo nivel: 1 KB alineadas a 1 KB, se reparten sin devolverse
+__attribute__((section(".mmu_tablas"), aligned(1024))) static uint32_t mmu_l2[MMU_L2_CANT][MMU_L2_ENTRADAS];
+__attribute__((section(".tcb_data"))) static uint32_t mmu_l2_usadas = 0;
+#endif
+
+SECCION_TEXT static void cache_set_way(uint32_t limpiar)
+{
+    uint32_t clidr;
+    uint32_t ccsidr;
+    uint32_t nivel = 0;
+    uint32_t loc;
+    uint32_t linea;
+    uint32_t vias;
+    uint32_t sets;
+    uint32_t desp_via;
+    uint32_t via = 0;
+    uint32_t set = 0;
+    uint32_t valor;
+
+    __asm__ volatile("MRC p15, 1, %0, c0, c0, 1" : "=r"(clidr)); // CLIDR
+    loc = (clidr >> 24) & 7U;
+    for (nivel = 0; nivel < loc; nivel++)
+    {
+        // Tipo 2 o más: el nivel tiene cache de datos o unificada
+        if (((clidr >> (nivel * 3U)) & 7U) >= 2U)
+        {
+            __asm__ volatile("MCR p15, 2, %0, c0, c0, 0\n\t" // CSSELR
+                             "ISB\n\t"
+                             "MRC p15, 1, %1, c0, c0, 0"     // CCSIDR del nivel elegido
+                             : "=r"(ccsidr)
+                             : "r"(nivel << 1)
+                             : "memory");
+            // No se divide: el formato de set/way es campos corridos
+            linea = (ccsidr & 7U) + 4U;
+            vias = (ccsidr >> 3) & 0x3FFU;
+            sets = (ccsidr >> 13) & 0x7FFFU;
+            desp_via = (vias == 0) ? 0 : (uint32_t)__builtin_clz(vias);
+            for (via = 0; via <= vias; via++)
+            {
+                for (set = 0; set <= sets; set++)
+                {
+                    valor = (via << desp_via) | (set << linea) | (nivel << 1);
+                    if (limpiar == 1)
+                    {
+                        __asm__ volatile("MCR p15, 0, %0, c7, c10, 2" : : "r"(valor) : "memory"); // DCCSW
+                    }
+                    else
+                    {
+                        __asm__ volatile("MCR p15, 0, %0, c7, c6, 2" : : "r"(valor) : "memory"); // DCISW
+                    }
+                }
+            }
+        }
+    }
+    __asm__ volatile("DSB\n\t"
+                     "ISB"
+                     :
+                     :
+                     : "memory");
+}
+
+SECCION_TEXT void mmu_init(void)
+{
+    uint32_t i = 0;
+    uint32_t base;
+
+    for (i = 0; i < MMU_ENTRADAS; i++)
+    {
+        base = i << MMU_SECCION_DESP;
+        mmu_tabla[i] = base | ((base >= MMU_RAM_INICIO && base < MMU_RAM_FIN) ? MMU_NORMAL : MMU_DISPOSITIVO);
+    }
+    mmu_habilitar();
+}
+
+SECCION_TEXT void mmu_habilitar(void)
+{
+    uint32_t sctlr;
+#ifdef SMP
+    uint32_t actlr;
+#endif
+
+    // Después del reset el contenido de las caches no está definido (el Cortex-A9 no las invalida solo)
+    cache_set_way(0);
+    __asm__ volatile("MCR p15, 0, %0, c7, c5, 0\n\t" // ICIALLU
+                     "MCR p15, 0, %0, c7, c5, 6\n\t" // BPIALL
+                     "MCR p15, 0, %0, c8, c7, 0\n\t" // TLBIALL
+                     "MCR p15, 0, %1, c3, c0, 0\n\t" // DACR
+                     "MCR p15, 0, %0, c2, c0, 2\n\t" // TTBCR = 0: solo TTBR0
+                     "MCR p15, 0, %2, c2, c0, 0\n\t" // TTBR0, recorridos sin cache: la tabla no hay que limpiarla
+                     "MCR p15, 0, %3, c13, c0, 1\n\t" // CONTEXTIDR: ASID del kernel
+                     "DSB\n\t"
+                     "ISB"
+                     :
+                     : "r"(0), "r"(DACR_CLIENTE), "r"((uint32_t)mmu_tabla), "r"(MMU_ASID_KERNEL)
+                     : "memory");
+
+#ifdef SMP
+    __asm__ volatile("MRC p15, 0, %0, c1, c0, 1" : "=r"(actlr));
+    actlr |= ACTLR_SMP;
+    __asm__ volatile("MCR p15, 0, %0, c1, c0, 1" : : "r"(actlr) : "memory");
+#endif
+
+    __asm__ volatile("MRC p15, 0, %0, c1, c0, 0" : "=r"(sctlr));
+    sctlr |= SCTLR_M | SCTLR_C | SCTLR_Z | SCTLR_I;
+    __asm__ volatile("MCR p15, 0, %0, c1, c0, 0\n\t"
+                     "ISB"
+                     :
+                     : "r"(sctlr)
+                     : "memory");
+}
+
+SECCION_TEXT void cache_limpiar_todo(void)
+{
+    cache_set_way(1);
+}
+
+SECCION_TEXT void cache_limpiar_rango(const void *inicio, uint32_t tam)
+{
+    uint32_t ctr;
+    uint32_t linea;
+    uint32_t dir;
+    uint32_t fin = (uint32_t)inicio + tam;
+
+    __asm__ volatile("MRC p15, 0, %0, c0, c0, 1" : "=r"(ctr)); // CTR
+    linea = 4U << ((ctr >> 16) & 0xFU);                          // DminLine, en bytes
+    for (dir = (uint32_t)inicio & ~(linea - 1U); dir < fin; dir += linea)
+    {
+        __asm__ volatile("MCR p15, 0, %0, c7, c10, 1" : : "r"(dir) : "memory"); // DCCMVAC
+    }
+    __asm__ volatile("DSB" : : : "memory");
+}
+
+#ifdef AISLAMIENTO
+SECCION_TEXT static uint32_t mmu_seccion_a_pagina(uint32_t s)
+{
+    // Los mismos atributos que la sección, reacomodados al formato de página chica
+    return MMU_PAGINA | ((s & MMU_SECCION_XN) >> 4) | (s & (MMU_SECCION_C | MMU_SECCION_B)) |
+           (((s >> 10) & 3U) << 4) | (((s >> 12) & 7U) << 6) | (((s >> 15) & 1U) << 9) |
+           (((s >> 16) & 1U) << 10) | (((s >> 17) & 1U) << 11);
+}
+
+SECCION_TEXT static uint32_t mmu_pagina_a_seccion(uint32_t bits)
+{
+    // Solo los bits que tocan los recorridos: permisos, XN y nG
+    return ((bits & MMU_PAGINA_XN) << 4) | (((bits >> 4) & 3U) << 10) | (((bits >> 11) & 1U) << 17);
+}
+
+SECCION_TEXT static uint32_t *mmu_l2_de(uint32_t *l1, uint32_t mb)
+{
+    uint32_t i = 0;
+    uint32_t desc = l1[mb];
+    uint32_t *l2;
+    uint32_t *origen;
+
+    // La tabla del kernel y las que ya son del espacio se modifican en el lugar
+    if ((desc & 3U) == MMU_TABLA && (l1 == mmu_tabla || desc != mmu_tabla[mb]))
+    {
+        return (uint32_t *)(desc & ~0x3FFU);
+    }
+    if (mmu_l2_usadas >= MMU_L2_CANT)
+    {
+        kprint_str("\n[mmu] no quedan tablas de segundo nivel (MMU_L2_CANT)\n");
+        halt_cpu();
+    }
+    l2 = mmu_l2[mmu_l2_usadas++];
+    if ((desc & 3U) == MMU_TABLA)
+    {
+        // MB compartida con el kernel: el espacio se queda con una copia
+        origen = (uint32_t *)(desc & ~0x3FFU);
+        for (i = 0; i < MMU_L2_ENTRADAS; i++)
+        {
+            l2[i] = origen[i];
+        }
+    }
+    else
+    {
+        for (i = 0; i < MMU_L2_ENTRADAS; i++)
+        {
+            l2[i] = ((desc & 0xFFF00000U) + (i << MMU_PAGINA_DESP)) | mmu_seccion_a_pagina(desc);
+        }
+    }
+    l1[mb] = (uint32_t)l2 | MMU_TABLA;
+    return l2;
+}
+
+SECCION_TEXT static void mmu_rango(uint32_t *l1, uint32_t inicio, uint32_t fin, uint32_t borrar, uint32_t poner)
+{
+    uint32_t dir = inicio & ~(MMU_PAGINA_TAM - 1U);
+    uint32_t mb = 0;
+    uint32_t *l2;
+
+    while (dir < fin)
+    {
+        mb = dir >> MMU_SECCION_DESP;
+        if ((dir & ((1U << MMU_SECCION_DESP) - 1U)) == 0 && fin - dir >= (1U << MMU_SECCION_DESP) &&
+            (l1[mb] & 3U) == MMU_SECCION)
+        {
+            // MB entera: se cambia la sección sin gastar una tabla de segundo nivel
+            l1[mb] = (l1[mb] & ~mmu_pagina_a_seccion(borrar)) | mmu_pagina_a_seccion(poner);
+            dir += 1U << MMU_SECCION_DESP;
+        }
+        else
+        {
+            l2 = mmu_l2_de(l1, mb);
+            l2[(dir >> MMU_PAGINA_DESP) & (MMU_L2_ENTRADAS - 1U)] =
+                (l2[(dir >> MMU_PAGINA_DESP) & (MMU_L2_ENTRADAS - 1U)] & ~borrar) | poner;
+            dir += MMU_PAGINA_TAM;
+        }
+    }
+}
+
+SECCION_TEXT void mmu_abrir_global(uint32_t inicio, uint32_t fin, uint32_t ap, uint32_t xn)
+{
+    mmu_rango(mmu_tabla, inicio, fin, MMU_PAGINA_AP_MASK | MMU_PAGINA_XN,
+              MMU_PAGINA_AP(ap) | ((xn != 0) ? MMU_PAGINA_XN : 0U));
+}
+
+SECCION_TEXT void mmu_marcar_privado(uint32_t inicio, uint32_t fin)
+{
+    mmu_rango(mmu_tabla, inicio, fin, 0U, MMU_PAGINA_NG);
+}
+
+SECCION_TEXT void mmu_espacio_crear(mmu_espacio_t *esp, uint32_t *l1, uint32_t asid)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < MMU_ENTRADAS; i++)
+    {
+        l1[i] = mmu_tabla[i];
+    }
+    esp->l1 = l1;
+    esp->asid = asid;
+}
+
+SECCION_TEXT void mmu_espacio_abrir(mmu_espacio_t *esp, uint32_t inicio, uint32_t fin, uint32_t ap)
+{
+    // Lo que la tarea puede escribir no se ejecuta
+    mmu_rango(esp->l1, inicio, fin, MMU_PAGINA_AP_MASK | MMU_PAGINA_XN,
+              MMU_PAGINA_AP(ap) | ((ap == MMU_AP_USR_RW) ? MMU_PAGINA_XN : 0U));
+}
+
+SECCION_TEXT void mmu_tablas_publicar(void)
+{
+    cache_limpiar_todo();
+    __asm__ volatile("MCR p15, 0, %0, c8, c7, 0\n\t" // TLBIALL: la tabla del kernel cambió con la MMU andando
+                     "MCR p15, 0, %0, c7, c5, 6\n\t" // BPIALL
+                     "DSB\n\t"
+                     "ISB"
+                     :
+                     : "r"(0)
+                     : "memory");
+}
+
+SECCION_TEXT void mmu_espacio_activar(const mmu_espacio_t *esp)
+{
+    uint32_t l1 = (esp != NULL) ? (uint32_t)esp->l1 : (uint32_t)mmu_tabla;
+    uint32_t asid = (esp != NULL) ? esp->asid : MMU_ASID_KERNEL;
+    uint32_t actual;
+
+    __asm__ volatile("MRC p15, 0, %0, c13, c0, 1" : "=r"(actual)); // CONTEXTIDR
+    if ((actual & 0xFFU) != asid)
+    {
+        // Con el ASID reservado en el medio, ningún recorrido mezcla la tabla vieja con el ASID nuevo.
+        // No se invalida el TLB ni el predictor: las traducciones son las mismas en todos los espacios.
+        // La vuelta de la excepción sincroniza el último cambio.
+        __asm__ volatile("MCR p15, 0, %0, c13, c0, 1\n\t"
+                         "ISB\n\t"
+                         "MCR p15, 0, %1, c2, c0, 0\n\t"
+                         "ISB\n\t"
+                         "MCR p15, 0, %2, c13, c0, 1"
+                         :
+                         : "r"(MMU_ASID_RESERVADO), "r"(l1), "r"(asid)
+                         : "memory");
+    }
+}
+SECCION_TEXT uint32_t mmu_espacio_accesible(const mmu_espacio_t *esp, uint32_t inicio, uint32_t largo, uint32_t escribir)
+{
+    uint32_t dir = inicio & ~(MMU_PAGINA_TAM - 1U);
+    uint32_t fin = inicio + largo;
+    uint32_t desc;
+    uint32_t ap;
+    uint32_t ret = (fin >= inicio) ? 1U : 0U;
+
+    while (ret == 1 && dir < fin)
+    {
+        desc = esp->l1[dir >> MMU_SECCION_DESP];
+        if ((desc & 3U) == MMU_TABLA)
+        {
+            desc = ((const uint32_t *)(desc & ~0x3FFU))[(dir >> MMU_PAGINA_DESP) & (MMU_L2_ENTRADAS - 1U)];
+            ap = ((desc & MMU_PAGINA) != 0) ? ((desc & MMU_PAGINA_AP_MASK) >> 4) : 0U;
+        }
+        else if ((desc & 3U) == MMU_SECCION)
+        {
+            ap = (desc >> 10) & 3U;
+        }
+        else
+        {
+            ap = 0; // Sin traducción
+        }
+        if (ap < MMU_AP_USR_RO || (escribir != 0 && ap != MMU_AP_USR_RW))
+        {
+            ret = 0;
+        }
+        dir += MMU_PAGINA_TAM;
+    }
+    return ret;
+}
+
+#endif // AISLAMIENTO
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    mpcore.c
+ * @brief   Implementación de la inicialización de los periféricos privados del Cortex-A9 MPCore
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+SECCION_TEXT void mpcore_init(void)
+{
+    volatile uint32_t *const SCU_CTRL = (volatile uint32_t *)MPCORE_SCU_ADDR;
+    *SCU_CTRL |= 1U;       // Habilita la SCU (coherencia entre las L1)
+    MPCORE_GICD_CTLR = 1U; // Habilita el distribuidor
+}
+
+SECCION_TEXT void mpcore_cpu_init(void)
+{
+    _gicc_t *const GICC = (_gicc_t *)MPCORE_GICC_ADDR;
+    _ptimer_t *const PTIMER = (_ptimer_t *)MPCORE_PTIMER_ADDR;
+
+    // ISENABLER0 está replicado por CPU: SGIs y PPIs se habilitan en cada una
+    MPCORE_GICD_ISENABLER(0) = (1U << GIC_SGI_WAKEUP) | (1U << GIC_SGI_RESCHED) | (1U << GIC_SOURCE_PTIMER);
+    GICC->PMR = 0xFFU;
+    GICC->CTLR = 1U;
+
+    PTIMER->Control = 0;
+    PTIMER->IntStatus = 1U;
+    PTIMER->Load = PTIMER_LOAD;
+    PTIMER->Control = PTIMER_CTRL_ENABLE | PTIMER_CTRL_AUTO_RELOAD | PTIMER_CTRL_IRQ_ENABLE;
+}
+
+SECCION_TEXT void gic_habilitar_fuente(uint32_t fuente)
+{
+    GICD_ISENABLER(fuente >> 5) = 1U << (fuente & 0x1FU);
+    GICD_ITARGETSR(fuente) = 1U;
+}
+
+SECCION_TEXT void mpcore_send_sgi(uint32_t sgi, uint32_t filtro, uint32_t cpus)
+{
+    __asm__ volatile("DSB" : : : "memory"); // Lo escrito antes del SGI tiene que verse en la otra CPU
+    MPCORE_GICD_SGIR = filtro | ((cpus & 0xFFU) << 16) | (sgi & 0xFU);
+}
+
+SECCION_TEXT uint32_t *PTIMER_IRQHandler(uint32_t *sp_irq)
+{
+    _ptimer_t *const PTIMER = (_ptimer_t *)MPCORE_PTIMER_ADDR;
+    PTIMER->IntStatus = 1U;
+    return tick_handler(sp_irq);
+}
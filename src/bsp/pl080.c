@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    pl080.c
+ * @brief   Driver del controlador DMA PL080: transmisión de la UART0 sin copiar byte a byte al FIFO
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+// Buffer circular de salida. inicio..fin_lote está en vuelo, fin_lote..fin espera el próximo lote.
+__attribute__((section(".tcb_data"), aligned(64))) static uint8_t dma_uart_buf[DMA_UART_BUF];
+__attribute__((section(".tcb_data"), aligned(16))) static pl080_lli_t dma_uart_lli[DMA_UART_CANT_LLI];
+__attribute__((section(".tcb_data"))) static uint32_t dma_uart_inicio;
+__attribute__((section(".tcb_data"))) static uint32_t dma_uart_fin_lote;
+__attribute__((section(".tcb_data"))) static uint32_t dma_uart_fin;
+__attribute__((section(".tcb_data"))) static uint8_t dma_uart_en_vuelo;
+__attribute__((section(".tcb_data"))) static uint8_t dma_uart_listo;
+__attribute__((section(".tcb_data"))) static spinlock_t dma_uart_lock = SPINLOCK_INIT;
+
+#ifdef DMA_UART_QEMU
+// QEMU no modela las líneas de pedido del PL011: se transfiere memoria a memoria sobre el DR,
+// que el modelo de la UART absorbe sin llenarse
+#define DMA_UART_CCFG (PL080_CCFG_FLUJO_M2M | PL080_CCFG_ITC | PL080_CCFG_IE)
+#else
+#define DMA_UART_CCFG (PL080_CCFG_FLUJO_M2P | PL080_CCFG_DEST_PERIF(DMA_UART_PEDIDO_TX) | PL080_CCFG_ITC | PL080_CCFG_IE)
+#endif
+
+#define DMA_UART_CTRL (PL080_CTRL_SI | PL080_CTRL_SWIDTH_8 | PL080_CTRL_DWIDTH_8 | \
+                       PL080_CTRL_SBSIZE(PL080_BURST_4) | PL080_CTRL_DBSIZE(PL080_BURST_4))
+
+SECCION_TEXT void dma_uart_init(void)
+{
+    _pl080_t *const DMAC = (_pl080_t *)PL080_ADDR;
+
+    dma_uart_inicio = 0;
+    dma_uart_fin_lote = 0;
+    dma_uart_fin = 0;
+    dma_uart_en_vuelo = 0;
+
+    DMAC->Configuration = PL080_CONFIG_E;
+    DMAC->canal[DMA_UART_CANAL].Configuration = 0;
+    DMAC->IntTCClear = 1U << DMA_UART_CANAL;
+    DMAC->IntErrClr = 1U << DMA_UART_CANAL;
+#ifndef DMA_UART_QEMU
+    PL011_DMACR(UART0_ADDR) = PL011_DMACR_TXDMAE;
+#endif
+
+    gic_habilitar_fuente(GIC_SOURCE_DMAC);
+
+    dma_uart_listo = 1;
+}
+
+// Arranca un lote con todo lo pendiente. Se llama con el lock tomado y el canal libre.
+SECCION_TEXT static void dma_uart_arrancar(void)
+{
+    _pl080_t *const DMAC = (_pl080_t *)PL080_ADDR;
+    _pl080_canal_t *const canal = &DMAC->canal[DMA_UART_CANAL];
+    uint32_t pos = dma_uart_inicio;
+    uint32_t pendiente = (dma_uart_fin - dma_uart_inicio) & (DMA_UART_BUF - 1U);
+    uint32_t tam;
+    uint32_t n = 0;
+#ifdef CACHE
+    uint32_t i = 0;
+#endif
+
+    // Un descriptor por tramo contiguo: el buffer da la vuelta a lo sumo una vez y cada tramo entra en 4095 bytes
+    while (pendiente > 0 && n < DMA_UART_CANT_LLI)
+    {
+        tam = DMA_UART_BUF - pos;
+        if (tam > pendiente)
+        {
+            tam = pendiente;
+        }
+        if (tam > PL080_CTRL_TAM_MAX)
+        {
+            tam = PL080_CTRL_TAM_MAX;
+        }
+        dma_uart_lli[n].src = (uint32_t)&dma_uart_buf[pos];
+        dma_uart_lli[n].dst = UART0_ADDR; // DR, sin incrementar
+        dma_uart_lli[n].lli = 0;
+        dma_uart_lli[n].ctrl = DMA_UART_CTRL | tam;
+        if (n > 0)
+        {
+            dma_uart_lli[n - 1].lli = (uint32_t)&dma_uart_lli[n];
+        }
+        pos = (pos + tam) & (DMA_UART_BUF - 1U);
+        pendiente -= tam;
+        n++;
+    }
+
+    if (n > 0)
+    {
+        dma_uart_lli[n - 1].ctrl |= PL080_CTRL_I; // Solo el último tramo interrumpe
+        dma_uart_fin_lote = pos;
+        dma_uart_en_vuelo = 1;
+#ifdef CACHE
+        // Con la cache de datos en write-back el PL080 leería memoria vieja
+        for (i = 0; i < n; i++)
+        {
+            cache_limpiar_rango((const void *)dma_uart_lli[i].src, dma_uart_lli[i].ctrl & PL080_CTRL_TAM_MAX);
+        }
+        cache_limpiar_rango(dma_uart_lli, n * sizeof(pl080_lli_t));
+#endif
+        __asm__ volatile("DSB" : : : "memory"); // Descriptores y datos en memoria antes de habilitar
+
+        canal->SrcAddr = dma_uart_lli[0].src;
+        canal->DestAddr = dma_uart_lli[0].dst;
+        canal->LLI = dma_uart_lli[0].lli;
+        canal->Control = dma_uart_lli[0].ctrl;
+        canal->Configuration = DMA_UART_CCFG | PL080_CCFG_E;
+    }
+}
+
+// Cierra el lote en vuelo si terminó. Se llama con el lock tomado.
+SECCION_TEXT static void dma_uart_completar(void)
+{
+    _pl080_t *const DMAC = (_pl080_t *)PL080_ADDR;
+    uint32_t mascara = 1U << DMA_UART_CANAL;
+
+    if (dma_uart_en_vuelo == 1 && (DMAC->EnbldChns & mascara) == 0)
+    {
+        DMAC->IntTCClear = mascara;
+        DMAC->IntErrClr = mascara;
+        dma_uart_inicio = dma_uart_fin_lote;
+        dma_uart_en_vuelo = 0;
+        dma_uart_arrancar();
+    }
+}
+
+SECCION_TEXT int dma_uart_escribir(const char *buf)
+{
+    uint32_t len = 0;
+
+    if (buf == NULL)
+    {
+        return -1;
+    }
+    while (buf[len] != '\0')
+    {
+        len++;
+    }
+    return dma_uart_escribir_len(buf, len);
+}
+
+SECCION_TEXT int dma_uart_escribir_len(const char *buf, uint32_t len)
+{
+    uint32_t i = 0;
+    uint32_t irq_flags;
+    _uart_t *const UART0 = (_uart_t *)UART0_ADDR;
+
+    if (buf == NULL)
+    {
+        return -1;
+    }
+    irq_flags = spin_lock_irqsave(&dma_uart_lock);
+    if (dma_uart_listo == 0)
+    {
+        // Antes de dma_uart_init se escribe directo en la UART
+        while (i < len)
+        {
+            uart_putc(UART0, (unsigned int)(buf[i]));
+            i++;
+        }
+    }
+    else
+    {
+        while (i < len)
+        {
+            // Se deja un lugar libre para distinguir lleno de vacío
+            while (((dma_uart_fin + 1U) & (DMA_UART_BUF - 1U)) == dma_uart_inicio)
+            {
+                if (dma_uart_en_vuelo == 0)
+                {
+                    dma_uart_arrancar();
+                }
+                dma_uart_completar();
+            }
+            dma_uart_buf[dma_uart_fin] = (uint8_t)buf[i];
+            dma_uart_fin = (dma_uart_fin + 1U) & (DMA_UART_BUF - 1U);
+            i++;
+        }
+        if (dma_uart_en_vuelo == 0)
+        {
+            dma_uart_arrancar();
+        }
+    }
+    spin_unlock_irqrestore(&dma_uart_lock, irq_flags);
+    return (int)i;
+}
+
+SECCION_TEXT void dma_uart_vaciar(void)
+{
+    uint32_t irq_flags = spin_lock_irqsave(&dma_uart_lock);
+    while (dma_uart_en_vuelo == 1)
+    {
+        dma_uart_completar();
+    }
+    spin_unlock_irqrestore(&dma_uart_lock, irq_flags);
+}
+
+SECCION_TEXT void DMAC_IRQHandler(void)
+{
+    _pl080_t *const DMAC = (_pl080_t *)PL080_ADDR;
+
+    // Solo se baja la interrupción; liberar el buffer y armar el próximo lote queda para la softirq
+    DMAC->IntTCClear = 1U << DMA_UART_CANAL;
+    DMAC->IntErrClr = 1U << DMA_UART_CANAL;
+    softirq_raise(SOFTIRQ_DMA);
+}
+
+SECCION_TEXT void dma_uart_softirq(void)
+{
+    uint32_t irq_flags = spin_lock_irqsave(&dma_uart_lock);
+    dma_uart_completar();
+    spin_unlock_irqrestore(&dma_uart_lock, irq_flags);
+}
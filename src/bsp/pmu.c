@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    pmu.c
+ * @brief   Implementación de funciones de acceso a la PMU del Cortex-A
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+SECCION_TEXT void pmu_init(void)
+{
+    uint32_t pmcr;
+    __asm__ volatile("MRC p15, 0, %0, c9, c12, 0" : "=r"(pmcr));   // Leo PMCR
+    pmcr |= PMU_PMCR_E | PMU_PMCR_C;
+    __asm__ volatile("MCR p15, 0, %0, c9, c12, 0" : : "r"(pmcr));  // Habilito y reinicio el contador de ciclos
+    __asm__ volatile("MCR p15, 0, %0, c9, c12, 1" : : "r"(PMU_CNTEN_CCNT)); // PMCNTENSET
+}
+
+SECCION_TEXT void pmu_evento_config(uint32_t contador, uint32_t evento)
+{
+    __asm__ volatile("MCR p15, 0, %0, c9, c12, 5\n\t" // PMSELR
+                     "ISB\n\t"
+                     "MCR p15, 0, %1, c9, c13, 1\n\t" // PMXEVTYPER
+                     "MCR p15, 0, %2, c9, c12, 1"      // PMCNTENSET
+                     :
+                     : "r"(contador), "r"(evento), "r"(1U << contador)
+                     : "memory");
+}
+
+SECCION_TEXT uint32_t pmu_evento_leer(uint32_t contador)
+{
+    uint32_t valor;
+    __asm__ volatile("MCR p15, 0, %1, c9, c12, 5\n\t" // PMSELR
+                     "ISB\n\t"
+                     "MRC p15, 0, %0, c9, c13, 2"      // PMXEVCNTR
+                     : "=r"(valor)
+                     : "r"(contador)
+                     : "memory");
+    return valor;
+}
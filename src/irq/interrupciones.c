@@ -30,31 +30,47 @@
 
 extern tcb_context_t tcb_tareas;
 
-__attribute__((section(".text"))) unsigned int identify_IRQ(void)
+SECCION_TEXT unsigned int identify_IRQ(void)
 {
     unsigned int irq_num;
-    _gicc_t *const GICC0 = (_gicc_t *)GICC0_ADDR;
+    _gicc_t *const GICC0 = (_gicc_t *)GICC_ADDR;
     irq_num = GICC0->IAR;
 
     return irq_num;
 }
 
-__attribute__((section(".text"))) uint32_t *C_IRQ_handler(uint32_t *sp_irq)
+SECCION_TEXT uint32_t *C_IRQ_handler(uint32_t *sp_irq)
 {
     unsigned int irq_ack;
     unsigned int irq_id;
     uint32_t *ret_sp_irq = sp_irq;
-    _gicc_t *const GICC0 = (_gicc_t *)GICC0_ADDR;
+    _gicc_t *const GICC0 = (_gicc_t *)GICC_ADDR;
+#if IRQ_LAT_MUESTRAS > 0
+    uint32_t lat_entrada = irq_lat_entrada(); // Lo primero: todo lo anterior cuenta como latencia
+#endif
+    irqoff_entrada();
     irq_ack = GICC0->IAR;
     irq_id = irq_ack & 0x3FFU;
     switch (irq_id)
     {
+#ifdef SMP
+    case GIC_SOURCE_PTIMER:
+        ret_sp_irq = PTIMER_IRQHandler(sp_irq);
+        break;
+    case GIC_SGI_RESCHED:
+        ret_sp_irq = RESCHED_IRQHandler(sp_irq);
+        break;
+#endif
     case GIC_SOURCE_TIMER0:
         ret_sp_irq = TIMER0_IRQHandler(sp_irq);
         break;
     case GIC_SOURCE_TIMER1:
+#if IRQ_LAT_MUESTRAS > 0
+        irq_lat_muestra(lat_entrada);
+#else
         // Manejar la interrupción del temporizador 1
         NOP;
+#endif
         break;
     case GIC_SOURCE_TIMER2:
         // Manejar la interrupción del temporizador 2
@@ -64,10 +80,28 @@ __attribute__((section(".text"))) uint32_t *C_IRQ_handler(uint32_t *sp_irq)
         // Manejar la interrupción del temporizador 3
         NOP;
         break;
+#ifdef DMA_UART
+    case GIC_SOURCE_DMAC:
+        DMAC_IRQHandler();
+        break;
+#endif
     case GIC_SOURCE_UART0:
-        // Manejar la interrupción del UART 0
-        NOP;
+        UART0_IRQHandler();
+#ifdef CONSOLA
+        consola_irq(0);
+#endif
         break;
+#ifdef CONSOLA
+    case GIC_SOURCE_UART1:
+        consola_irq(1);
+        break;
+    case GIC_SOURCE_UART2:
+        consola_irq(2);
+        break;
+    case GIC_SOURCE_UART3:
+        consola_irq(3);
+        break;
+#else
     case GIC_SOURCE_UART1:
         // Manejar la interrupción del UART 1
         NOP;
@@ -80,6 +114,7 @@ __attribute__((section(".text"))) uint32_t *C_IRQ_handler(uint32_t *sp_irq)
         // Manejar la interrupción del UART 3
         NOP;
         break;
+#endif
     default:
         NOP; // Placeholder para manejar otras interrupciones
         break;
@@ -90,28 +125,82 @@ __attribute__((section(".text"))) uint32_t *C_IRQ_handler(uint32_t *sp_irq)
     return ret_sp_irq;
 }
 
-__attribute__((section(".text"))) uint32_t *TIMER0_IRQHandler(uint32_t *sp_irq)
+SECCION_TEXT uint32_t *TIMER0_IRQHandler(uint32_t *sp_irq)
+{
+    _timer_t *const TIMER0 = (_timer_t *)TIMER0_ADDR;
+
+    // Limpiar la interrupción del timer para evitar reentradas
+    TIMER0->Timer1IntClr = 1U;
+    return tick_handler(sp_irq);
+}
+
+SECCION_TEXT static uint32_t *despachar(uint32_t *sp_irq, uint8_t tick)
 {
     uint32_t *ret_sp_irq = sp_irq;
+    uint8_t primer_despacho = 0;
+    cpu_t *cpu = &tcb_tareas.cpus[cpu_id()];
     tcb_t *actual;
     tcb_t *next;
-    _timer_t *const TIMER0 = (_timer_t *)TIMER0_ADDR;
 
-    actual = &tcb_tareas.tareas[tcb_tareas.task_id_actual];
-    if (tcb_tareas.run == 1)
+    if (tick == 1)
+    {
+        // La contabilidad del tick no se posterga, aunque el cambio de tarea sí
+        scheduler_tick();
+    }
+    if (softirq_en_curso() == 1)
     {
-        // Guardar contexto de la tarea actual
-        save_context(actual, sp_irq);
+        // Las softirqs no se desalojan: la tarea interrumpida sigue y se replanifica en el próximo tick
+        cpu->resched = 1;
     }
+    else
+    {
+#if STRESS_TAREAS > 0
+        stress_sched_entrada();
+#endif
+        actual = cpu->actual;
+        if (cpu->run == 1)
+        {
+            // Guardar contexto de la tarea actual
+            save_context(actual, sp_irq);
+            stack_check_canary(actual->task_id);
+        }
+        else
+        {
+            // El contexto de arranque queda como contexto idle de la CPU
+            save_context(&cpu->idle, sp_irq);
+            primer_despacho = 1;
+        }
 
-    // Lógica de cambio de tarea
-    scheduler();
+        // Lógica de cambio de tarea
+        scheduler_replanificar();
 
-    // Limpiar la interrupción del timer para evitar reentradas
-    TIMER0->Timer1IntClr = 1U;
+        // Cargar contexto de la nueva tarea
+        next = cpu->actual;
+        context_switch(next, &ret_sp_irq);
+#if STRESS_TAREAS > 0
+        stress_sched_salida();
+#endif
 
-    // Cargar contexto de la nueva tarea
-    next = &tcb_tareas.tareas[tcb_tareas.task_id_actual];
-    context_switch(next, &ret_sp_irq);
+        if (primer_despacho == 1 && cpu_id() == 0)
+        {
+            boot_prof_mark(BOOT_PHASE_FIRST_TASK);
+            boot_prof_report_diferido(); // El reporte se imprime fuera de la IRQ
+        }
+    }
     return ret_sp_irq;
 }
+
+SECCION_TEXT uint32_t *tick_handler(uint32_t *sp_irq)
+{
+    // El reloj se actualiza en la mitad inferior, con las IRQ habilitadas
+    softirq_tick();
+#if STRESS_TAREAS > 0
+    stress_ciclos_tick();
+#endif
+    return despachar(sp_irq, 1);
+}
+
+SECCION_TEXT uint32_t *resched_handler(uint32_t *sp_irq)
+{
+    return despachar(sp_irq, 0);
+}
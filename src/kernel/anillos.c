@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    anillos.c
+ * @brief   Procesamiento de los anillos de envío y de completado
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+extern tcb_context_t tcb_tareas;
+
+// El estado de cada tarea sale de una cache de kmem recién cuando registra su primer anillo:
+// con STRESS son cientos de tareas y casi ninguna usa anillos
+__attribute__((section(".tcb_data"))) anillo_tarea_t *anillos[CANT_TASKS];
+__attribute__((section(".tcb_data"))) static kmem_cache_t *anillos_cache;
+__attribute__((section(".tcb_data"))) static uint32_t anillos_registrados;
+__attribute__((section(".tcb_data"))) static uint32_t anillos_ticks;
+
+// Agrega una completion. Devuelve 0 si el anillo de completado está lleno.
+SECCION_TEXT static uint32_t anillo_completar(anillo_tarea_t *at, uint32_t user_data, int32_t res)
+{
+    uint32_t ret = 0;
+    anillo_t *a = at->anillo;
+    anillo_cqe_t *cqe;
+
+    if (a->cq_cola - a->cq_cabeza < ANILLO_CQ_CANT(at->sq_cant))
+    {
+        cqe = &at->cq[a->cq_cola & (ANILLO_CQ_CANT(at->sq_cant) - 1U)];
+        cqe->user_data = user_data;
+        cqe->res = res;
+        __asm__ volatile("DMB" : : : "memory"); // La entrada antes que el índice
+        a->cq_cola++;
+        ret = 1;
+    }
+    return ret;
+}
+
+SECCION_TEXT static int32_t anillo_timer_armar(anillo_tarea_t *at, uint32_t ticks, uint32_t user_data)
+{
+    uint32_t i = 0;
+    int32_t ret = -1;
+
+    for (i = 0; i < ANILLO_TIMERS && ret != 0; i++)
+    {
+        if (at->timers[i].activo == 0)
+        {
+            at->timers[i].vence = anillos_ticks + ticks;
+            at->timers[i].user_data = user_data;
+            at->timers[i].activo = 1;
+            ret = 0;
+        }
+    }
+    return ret;
+}
+
+// Procesa hasta presupuesto envíos. Se llama con el lock de la tarea tomado (irq_flags de spin_lock_irqsave).
+// Con ANILLO_ESCRIBIR_NO se detiene en el primer ANILLO_OP_WRITE: la UART por polling no se usa desde el tick.
+// Si no, suelta el lock mientras escribe, así que el estado del anillo se relee después.
+SECCION_TEXT static uint32_t anillo_drenar(anillo_tarea_t *at, uint32_t task_id, uint32_t presupuesto,
+                                          uint8_t escrituras, uint32_t *irq_flags)
+{
+    const tcb_t *tcb = &tcb_tareas.tareas[task_id]; // Los punteros son de la dueña, no de la tarea actual
+    anillo_t *a = at->anillo;
+    anillo_sqe_t *sqe;
+    uint32_t cola = a->sq_cola;
+    uint32_t n = 0;
+    int32_t res;
+    int32_t largo;
+    const char *texto;
+    uint8_t completa;
+
+    __asm__ volatile("DMB" : : : "memory"); // El índice antes que las entradas
+
+    // Sin lugar para la completion no se consume: la tarea tiene que leer primero.
+    // Si otro drenaje está escribiendo, el anillo es suyo hasta que publique la completion.
+    while (at->escribiendo == 0 && a->sq_cabeza != cola && n < presupuesto &&
+           a->cq_cola - a->cq_cabeza < ANILLO_CQ_CANT(at->sq_cant))
+    {
+        sqe = &at->sq[a->sq_cabeza & (at->sq_cant - 1U)];
+        if (sqe->op == ANILLO_OP_WRITE && escrituras == ANILLO_ESCRIBIR_NO)
+        {
+            break; // Queda para anillo_enter o la idle, respetando el orden
+        }
+        res = 0;
+        completa = 1;
+        switch (sqe->op)
+        {
+        case ANILLO_OP_NOP:
+            NOP;
+            break;
+        case ANILLO_OP_WRITE:
+            texto = (const char *)sqe->arg0;
+            largo = espacios_usuario_cadena(tcb, texto);
+            res = -1;
+            if (largo >= 0)
+            {
+                // La UART por polling no se espera con el lock tomado. El envío sigue sin consumir y el
+                // lugar de la completion queda reservado: escribiendo frena a los demás drenajes y timers.
+                at->escribiendo = 1;
+                spin_unlock_irqrestore(&at->lock, *irq_flags);
+                if (escrituras == ANILLO_ESCRIBIR_SVC)
+                {
+                    // Como SYS_WRITE: el resto de anillo_enter, que puede bloquear, sigue atómico
+                    SVC_IRQ_HABILITAR();
+                }
+                res = sys_my_printf_len(texto, (uint32_t)largo);
+                if (escrituras == ANILLO_ESCRIBIR_SVC)
+                {
+                    SVC_IRQ_DESHABILITAR();
+                }
+                *irq_flags = spin_lock_irqsave(&at->lock);
+                at->escribiendo = 0;
+            }
+            break;
+        case ANILLO_OP_TIMER:
+            res = anillo_timer_armar(at, sqe->arg0, sqe->user_data);
+            completa = (res == 0) ? 0 : 1; // Armado: se completa al vencer
+            break;
+        case ANILLO_OP_CLOCK:
+            res = -1;
+            if (espacios_usuario_valido(tcb, (const void *)sqe->arg1, sizeof(timespec_t), 1U) == 1)
+            {
+                res = sys_clock_gettime(sqe->arg0, (timespec_t *)sqe->arg1);
+            }
+            break;
+        default:
+            res = -1;
+            break;
+        }
+        if (completa == 1)
+        {
+            anillo_completar(at, sqe->user_data, res);
+        }
+        a->sq_cabeza++;
+        n++;
+    }
+    return n;
+}
+
+SECCION_TEXT static void anillo_vencer_timers(anillo_tarea_t *at)
+{
+    uint32_t i = 0;
+    anillo_timer_t *t;
+
+    for (i = 0; i < ANILLO_TIMERS; i++)
+    {
+        t = &at->timers[i];
+        // Si el anillo de completado está lleno, o hay una escritura en curso que ya reservó su lugar,
+        // el timer sigue armado y se reintenta en el próximo tick
+        if (t->activo == 1 && at->escribiendo == 0 && (int32_t)(anillos_ticks - t->vence) >= 0 &&
+            anillo_completar(at, t->user_data, 0) == 1)
+        {
+            t->activo = 0;
+        }
+    }
+}
+
+SECCION_TEXT static void anillo_despertar(anillo_tarea_t *at, uint32_t task_id)
+{
+    if (at->esperando == 1 && at->anillo->cq_cola != at->anillo->cq_cabeza)
+    {
+        at->esperando = 0;
+        scheduler_despertar(&tcb_tareas.tareas[task_id]);
+    }
+}
+
+// Solo la dueña lo crea, y se publica ya inicializado: los drenajes de otras CPUs lo ven completo o no lo ven
+SECCION_TEXT static anillo_tarea_t *anillo_tarea_obtener(uint32_t task_id)
+{
+    anillo_tarea_t *at = anillos[task_id];
+
+    if (at == NULL)
+    {
+        at = (anillo_tarea_t *)kmem_cache_alloc(anillos_cache);
+        if (at != NULL)
+        {
+            at->anillo = NULL;
+            at->lock = (spinlock_t)SPINLOCK_INIT;
+            at->esperando = 0;
+            at->escribiendo = 0;
+            __asm__ volatile("DMB" : : : "memory"); // El estado antes que el puntero
+            anillos[task_id] = at;
+        }
+    }
+    return at;
+}
+
+SECCION_TEXT void anillos_init(void)
+{
+    // Alineado a línea: lo tocan el tick y la idle de otras CPUs
+    anillos_cache = kmem_cache_create("anillo_tarea", sizeof(anillo_tarea_t), KMEM_FLAG_LINEA);
+}
+
+SECCION_TEXT int sys_anillo_registrar(anillo_t *anillo, uint32_t sq_cant)
+{
+    int ret = -1;
+    uint32_t i = 0;
+    uint32_t irq_flags;
+    anillo_tarea_t *at = NULL;
+    uint32_t task_id = scheduler_actual()->task_id;
+
+    if (anillo != NULL && task_id < CANT_TASKS && sq_cant > 0 && sq_cant <= ANILLO_SQ_MAX &&
+        (sq_cant & (sq_cant - 1U)) == 0 &&
+        espacios_usuario_valido(scheduler_actual(), anillo, ANILLO_TAM(sq_cant), 1U) == 1)
+    {
+        at = anillo_tarea_obtener(task_id);
+    }
+    if (at != NULL)
+    {
+        irq_flags = spin_lock_irqsave(&at->lock);
+        // Con una escritura en curso (desde la idle de otra CPU) el anillo no se puede reemplazar
+        if (at->escribiendo == 0)
+        {
+            anillo->sq_cabeza = 0;
+            anillo->sq_cola = 0;
+            anillo->cq_cabeza = 0;
+            anillo->cq_cola = 0;
+            anillo->sq_local = 0;
+            anillo->sq_cant = sq_cant;
+            at->sq = ANILLO_SQ(anillo);
+            at->cq = ANILLO_CQ(anillo, sq_cant);
+            at->sq_cant = sq_cant;
+            for (i = 0; i < ANILLO_TIMERS; i++)
+            {
+                at->timers[i].activo = 0;
+            }
+            at->esperando = 0;
+            if (at->anillo == NULL)
+            {
+                anillos_registrados++;
+            }
+            at->anillo = anillo;
+            ret = 0;
+        }
+        spin_unlock_irqrestore(&at->lock, irq_flags);
+    }
+    return ret;
+}
+
+SECCION_TEXT int sys_anillo_enter(uint32_t esperar, uint32_t *bloqueada)
+{
+    int ret = -1;
+    uint32_t irq_flags;
+    anillo_tarea_t *at;
+    uint32_t task_id = scheduler_actual()->task_id;
+
+    *bloqueada = 0;
+    if (task_id < CANT_TASKS && anillos[task_id] != NULL && anillos[task_id]->anillo != NULL)
+    {
+        at = anillos[task_id];
+        irq_flags = spin_lock_irqsave(&at->lock);
+        ret = (int)anillo_drenar(at, task_id, at->sq_cant, ANILLO_ESCRIBIR_SVC, &irq_flags);
+        if (esperar != 0 && at->anillo->cq_cola == at->anillo->cq_cabeza)
+        {
+            // Nada para leer todavía: duerme hasta que un timer o el próximo lote completen algo
+            at->esperando = 1;
+            scheduler_bloquear_actual();
+            *bloqueada = 1;
+        }
+        spin_unlock_irqrestore(&at->lock, irq_flags);
+    }
+    return ret;
+}
+
+SECCION_TEXT void anillos_tick(void)
+{
+    uint32_t i = 0;
+    uint32_t irq_flags;
+    anillo_tarea_t *at;
+
+    anillos_ticks++;
+    for (i = 0; i < CANT_TASKS && anillos_registrados > 0; i++)
+    {
+        at = anillos[i];
+        if (at != NULL && at->anillo != NULL)
+        {
+            irq_flags = spin_lock_irqsave(&at->lock);
+            anillo_vencer_timers(at);
+            anillo_drenar(at, i, ANILLO_PRESUPUESTO_TICK, ANILLO_ESCRIBIR_NO, &irq_flags);
+            anillo_despertar(at, i);
+            spin_unlock_irqrestore(&at->lock, irq_flags);
+        }
+    }
+}
+
+SECCION_TEXT void anillos_idle(void)
+{
+    uint32_t i = 0;
+    uint32_t irq_flags;
+    anillo_tarea_t *at;
+
+    for (i = 0; i < CANT_TASKS && anillos_registrados > 0; i++)
+    {
+        at = anillos[i];
+        if (at != NULL && at->anillo != NULL && at->anillo->sq_cabeza != at->anillo->sq_cola)
+        {
+            irq_flags = spin_lock_irqsave(&at->lock);
+            anillo_drenar(at, i, ANILLO_PRESUPUESTO_IDLE, ANILLO_ESCRIBIR_SI, &irq_flags);
+            anillo_despertar(at, i);
+            spin_unlock_irqrestore(&at->lock, irq_flags);
+        }
+    }
+}
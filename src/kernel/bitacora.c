@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    bitacora.c
+ * @brief   Implementación de la bitácora binaria: registros de largo fijo por argumento hacia la UART de la bitácora
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+#include "board/uart.h"
+
+#ifdef BITACORA
+
+SECCION_TEXT uint32_t bitacora_armar(uint32_t *reg, uint32_t cabecera, uint32_t tiempo, va_list args)
+{
+    uint32_t i = 0;
+    uint32_t n = BITACORA_NARGS(cabecera);
+
+    reg[0] = cabecera;
+    reg[1] = tiempo;
+    for (i = 0; i < n; i++)
+    {
+        reg[2 + i] = va_arg(args, uint32_t);
+    }
+    return (2U + n) * 4U;
+}
+
+#ifndef CONSOLA
+static const uint32_t bitacora_bases[] = {UART0_ADDR, UART1_ADDR, UART2_ADDR, UART3_ADDR};
+__attribute__((section(".tcb_data"))) static spinlock_t bitacora_lock = SPINLOCK_INIT;
+#endif
+
+SECCION_TEXT void bitacora_init(void)
+{
+#ifndef CONSOLA
+    __uart_init((int)BITACORA_UART);
+#endif
+}
+
+SECCION_TEXT static int bitacora_enviar(const uint32_t *reg, uint32_t len)
+{
+#ifdef CONSOLA
+    return consola_escribir(BITACORA_UART, (const char *)reg, len);
+#else
+    uint32_t i = 0;
+    uint32_t irq_flags;
+    uint32_t base = bitacora_bases[BITACORA_UART];
+    const uint8_t *p = (const uint8_t *)reg;
+
+    // Un registro entero bajo el lock: los de distintas CPUs no se mezclan en el flujo
+    irq_flags = spin_lock_irqsave(&bitacora_lock);
+    for (i = 0; i < len; i++)
+    {
+        while ((PL011_REG(base, PL011_FR) & PL011_FR_TXFF) != 0)
+        {
+        }
+        PL011_REG(base, PL011_DR) = p[i];
+    }
+    spin_unlock_irqrestore(&bitacora_lock, irq_flags);
+    return (int)len;
+#endif
+}
+
+SECCION_TEXT void kbitacora(uint32_t cabecera, ...)
+{
+    uint32_t reg[BITACORA_REG_PALABRAS];
+    uint32_t len;
+    va_list args;
+
+    va_start(args, cabecera);
+    len = bitacora_armar(reg, cabecera, clock_ciclos(), args);
+    va_end(args);
+    (void)bitacora_enviar(reg, len);
+}
+
+SECCION_TEXT int sys_bitacora(const uint32_t *reg, uint32_t len)
+{
+    int ret = -1;
+
+    // Solo registros bien formados: un flujo roto haría perder la sincronización a la herramienta
+    if (reg != NULL && len >= 8U && len <= BITACORA_REG_PALABRAS * 4U &&
+        espacios_usuario_valido(scheduler_actual(), reg, len, 0U) == 1 && (reg[0] & 0xFFU) == BITACORA_SINCRO &&
+        len == (2U + BITACORA_NARGS(reg[0])) * 4U)
+    {
+        ret = bitacora_enviar(reg, len);
+    }
+    return ret;
+}
+
+#endif // BITACORA
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    clock.c
+ * @brief   Implementación de la fuente de tiempo monotónica de alta resolución
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+__attribute__((section(".clock_page"), aligned(4096))) clock_page_t clock_page;
+
+SECCION_TEXT void clock_init(void)
+{
+    _timer_t *const TIMER = (_timer_t *)CLOCK_TIMER_ADDR;
+
+    TIMER->Timer1Ctrl = 0;
+    TIMER->Timer1Load = 0xFFFFFFFFU;
+    TIMER->Timer1Ctrl = SP804_CTRL_ENABLE | SP804_CTRL_32BIT; // Modo libre, sin interrupción
+
+    clock_page.seq = 0;
+    clock_page.ciclos_base = clock_ciclos();
+    clock_page.ciclos_hi = 0;
+    clock_page.seg_base = 0;
+    clock_page.nseg_base = 0;
+    clock_page.ns_base = 0;
+    clock_page.mult = CLOCK_MULT;
+    clock_page.shift = CLOCK_SHIFT;
+    clock_page.timer_addr = CLOCK_TIMER_ADDR;
+}
+
+SECCION_TEXT uint32_t clock_ciclos(void)
+{
+    _timer_t *const TIMER = (_timer_t *)CLOCK_TIMER_ADDR;
+    return 0xFFFFFFFFU - TIMER->Timer1Value; // El SP804 cuenta hacia abajo
+}
+
+SECCION_TEXT void clock_tick(void)
+{
+    uint32_t ahora;
+    uint32_t delta;
+    uint32_t nseg;
+    uint64_t delta_ns;
+
+    if (cpu_id() == 0)
+    {
+        ahora = clock_ciclos();
+        delta = ahora - clock_page.ciclos_base; // Aritmética módulo 2^32: tolera una vuelta
+        delta_ns = ((uint64_t)delta * CLOCK_MULT) >> CLOCK_SHIFT;
+
+        clock_page.seq++;
+        __asm__ volatile("DMB" : : : "memory");
+        if (ahora < clock_page.ciclos_base)
+        {
+            clock_page.ciclos_hi++;
+        }
+        clock_page.ciclos_base = ahora;
+        clock_page.ns_base += delta_ns;
+        nseg = clock_page.nseg_base + (uint32_t)delta_ns;
+        while (nseg >= NSEC_POR_SEG)
+        {
+            nseg -= NSEC_POR_SEG;
+            clock_page.seg_base++;
+        }
+        clock_page.nseg_base = nseg;
+        __asm__ volatile("DMB" : : : "memory");
+        clock_page.seq++;
+    }
+}
+
+SECCION_TEXT uint64_t clock_ciclos64(void)
+{
+    uint32_t seq;
+    uint32_t hi;
+    uint32_t base;
+    uint32_t ahora;
+    do
+    {
+        seq = clock_page.seq;
+        __asm__ volatile("DMB" : : : "memory");
+        hi = clock_page.ciclos_hi;
+        base = clock_page.ciclos_base;
+        ahora = clock_ciclos();
+        __asm__ volatile("DMB" : : : "memory");
+    } while ((seq & 1U) != 0 || seq != clock_page.seq);
+
+    if (ahora < base)
+    {
+        hi++; // Dio la vuelta después del último tick
+    }
+    return ((uint64_t)hi << 32) | ahora;
+}
+
+SECCION_TEXT uint64_t clock_ns(void)
+{
+    uint32_t seq;
+    uint64_t ns;
+    do
+    {
+        seq = clock_page.seq;
+        __asm__ volatile("DMB" : : : "memory");
+        ns = clock_page.ns_base +
+             (((uint64_t)(clock_ciclos() - clock_page.ciclos_base) * clock_page.mult) >> clock_page.shift);
+        __asm__ volatile("DMB" : : : "memory");
+    } while ((seq & 1U) != 0 || seq != clock_page.seq);
+    return ns;
+}
+
+SECCION_TEXT void clock_page_leer(timespec_t *ts)
+{
+    clock_page_leer_inline(ts);
+}
+
+SECCION_TEXT int sys_clock_gettime(uint32_t clk_id, timespec_t *ts)
+{
+    int ret = -1;
+    if (clk_id == CLOCK_MONOTONIC && ts != NULL)
+    {
+        clock_page_leer(ts);
+        ret = 0;
+    }
+    return ret;
+}
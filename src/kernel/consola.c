@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    consola.c
+ * @brief   Consola multiplexada: cada UART tiene su cola de transmisión y su interrupción
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+#include "board/uart.h"
+
+#ifdef CONSOLA
+
+extern tcb_context_t tcb_tareas;
+
+static const uint32_t consola_bases[CONSOLA_CANALES] = {UART0_ADDR, UART1_ADDR, UART2_ADDR, UART3_ADDR};
+static const uint32_t consola_fuentes[CONSOLA_CANALES] = {GIC_SOURCE_UART0, GIC_SOURCE_UART1, GIC_SOURCE_UART2,
+                                                          GIC_SOURCE_UART3};
+
+__attribute__((section(".tcb_data"))) static consola_canal_t consola_canales[CONSOLA_CANALES];
+__attribute__((section(".tcb_data"))) static uint8_t consola_tareas[CANT_TASKS]; // Canal de cada tarea
+
+SECCION_TEXT static void consola_llenar_fifo(consola_canal_t *c)
+{
+    while (c->inicio != c->fin && (PL011_REG(c->base, PL011_FR) & PL011_FR_TXFF) == 0)
+    {
+        PL011_REG(c->base, PL011_DR) = c->buf[c->inicio];
+        c->inicio = (c->inicio + 1U) & (CONSOLA_TX_BUF - 1U);
+    }
+    // La interrupción solo hace falta mientras quede algo en la cola
+    if (c->inicio == c->fin)
+    {
+        PL011_REG(c->base, PL011_IMSC) &= ~PL011_INT_TX;
+    }
+    else
+    {
+        PL011_REG(c->base, PL011_IMSC) |= PL011_INT_TX;
+    }
+}
+
+SECCION_TEXT void consola_init(void)
+{
+    uint32_t i = 0;
+    consola_canal_t *c;
+
+    for (i = 0; i < CONSOLA_CANALES; i++)
+    {
+        c = &consola_canales[i];
+        c->base = consola_bases[i];
+        c->inicio = 0;
+        c->fin = 0;
+        c->lock.lock = 0;
+        c->stats.bytes = 0;
+        c->stats.esperas = 0;
+        c->stats.interrupciones = 0;
+
+        __uart_init((int)i);
+        PL011_REG(c->base, PL011_IFLS) = (PL011_REG(c->base, PL011_IFLS) & ~7U) | PL011_IFLS_TX_MITAD;
+        PL011_REG(c->base, PL011_ICR) = PL011_INT_TX;
+        gic_habilitar_fuente(consola_fuentes[i]);
+    }
+
+    // Mapa estático: el kernel, la idle, la worker y las de carga en UART0; las tareas 1 a 3 en UART1 a UART3
+    for (i = 0; i < CANT_TASKS; i++)
+    {
+        consola_tareas[i] = (i >= TASK_1 && i <= TASK_3) ? (uint8_t)(i - TASK_1 + 1U) : 0U;
+#ifdef BITACORA
+        if (consola_tareas[i] == BITACORA_UART)
+        {
+            consola_tareas[i] = 0; // La UART de la bitácora lleva solo registros binarios
+        }
+#endif
+    }
+}
+
+SECCION_TEXT int consola_escribir(uint32_t canal, const char *buf, uint32_t len)
+{
+    uint32_t i = 0;
+    uint32_t sig;
+    uint32_t irq_flags;
+    uint8_t espero = 0;
+    consola_canal_t *c;
+
+    if (buf == NULL || canal >= CONSOLA_CANALES)
+    {
+        return -1;
+    }
+#ifdef DMA_UART
+    if (canal == 0)
+    {
+        return dma_uart_escribir_len(buf, len); // La UART0 la alimenta el PL080
+    }
+#endif
+    c = &consola_canales[canal];
+    irq_flags = spin_lock_irqsave(&c->lock);
+    for (i = 0; i < len; i++)
+    {
+        sig = (c->fin + 1U) & (CONSOLA_TX_BUF - 1U);
+        while (sig == c->inicio)
+        {
+            // Cola llena: se vacía en el lugar a medida que el FIFO acepta bytes
+            espero = 1;
+            consola_llenar_fifo(c);
+        }
+        c->buf[c->fin] = (uint8_t)buf[i];
+        c->fin = sig;
+    }
+    c->stats.bytes += len;
+    c->stats.esperas += espero;
+    consola_llenar_fifo(c);
+    spin_unlock_irqrestore(&c->lock, irq_flags);
+    return (int)len;
+}
+
+SECCION_TEXT int sys_consola_escribir(const char *buf, uint32_t len)
+{
+    uint32_t task_id = scheduler_actual()->task_id;
+
+    // Los contextos de arranque (TASK_INIT) no tienen canal propio: escriben por el del kernel
+    return consola_escribir((task_id < CANT_TASKS) ? consola_tareas[task_id] : 0U, buf, len);
+}
+
+SECCION_TEXT int sys_consola_asignar(uint32_t canal)
+{
+    tcb_t *tcb = scheduler_actual();
+
+#ifdef BITACORA
+    if (canal == BITACORA_UART)
+    {
+        return -1;
+    }
+#endif
+    if (canal >= CONSOLA_CANALES || tcb->task_id >= CANT_TASKS)
+    {
+        return -1;
+    }
+    consola_tareas[tcb->task_id] = (uint8_t)canal;
+    return 0;
+}
+
+SECCION_TEXT void consola_vaciar(uint32_t canal)
+{
+    consola_canal_t *c = &consola_canales[canal];
+
+    while (c->inicio != c->fin)
+    {
+        consola_llenar_fifo(c);
+    }
+}
+
+SECCION_TEXT void consola_irq(uint32_t canal)
+{
+    consola_canal_t *c = &consola_canales[canal];
+
+    if ((PL011_REG(c->base, PL011_MIS) & PL011_INT_TX) != 0)
+    {
+        spin_lock(&c->lock);
+        c->stats.interrupciones++;
+        PL011_REG(c->base, PL011_ICR) = PL011_INT_TX;
+        consola_llenar_fifo(c);
+        spin_unlock(&c->lock);
+    }
+}
+
+SECCION_TEXT void consola_report(void)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < CONSOLA_CANALES; i++)
+    {
+        kprint_str("[consola] uart");
+        kprint_dec(i);
+        kprint_str(" bytes: ");
+        kprint_dec(consola_canales[i].stats.bytes);
+        kprint_str(" irqs: ");
+        kprint_dec(consola_canales[i].stats.interrupciones);
+        kprint_str(" esperas: ");
+        kprint_dec(consola_canales[i].stats.esperas);
+        kprint_str("\n");
+    }
+}
+
+#endif // CONSOLA
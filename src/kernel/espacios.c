@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    espacios.c
+ * @brief   Espacios de direcciones de las tareas de usuario: una tabla y un ASID por espacio
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+#ifdef AISLAMIENTO
+
+#if (HEAP_TAREA_TAM % MMU_PAGINA_TAM) != 0
+#error "Con AISLAMIENTO la arena de cada tarea tiene que ser múltiplo de 4 KB"
+#endif
+
+extern tcb_context_t tcb_tareas;
+extern stack_info_t stack_info[CANT_TASKS][STACK_CANT_MODOS];
+extern uint32_t _text_start_;
+extern uint32_t _usuario_data_start_;
+extern uint32_t _usuario_data_end_;
+extern uint32_t _clock_page_start_;
+extern uint32_t _clock_page_end_;
+extern uint32_t _tareas_heap_start_;
+extern uint32_t _tareas_heap_end_;
+#if STRESS_TAREAS > 0
+extern uint32_t _stress_stacks_sys_start_;
+extern uint32_t _stress_stacks_sys_end_;
+#endif
+extern void usuario_abortar(void);
+
+__attribute__((section(".mmu_tablas"), aligned(16384))) static uint32_t espacios_tablas[ESPACIOS_CANT][MMU_ENTRADAS];
+__attribute__((section(".tcb_data"))) static mmu_espacio_t espacios[ESPACIOS_CANT];
+
+SECCION_TEXT static uint32_t espacios_pila_inicio(uint32_t task_id)
+{
+    return (uint32_t)stack_info[task_id][STACK_SYS].base;
+}
+
+SECCION_TEXT static uint32_t espacios_pila_fin(uint32_t task_id)
+{
+    return (uint32_t)stack_info[task_id][STACK_SYS].top;
+}
+
+SECCION_TEXT static uint32_t espacios_arena(uint32_t task_id)
+{
+    return (uint32_t)tcb_tareas.tareas[task_id].tls;
+}
+
+SECCION_TEXT static void espacios_usuario(tcb_t *tcb, mmu_espacio_t *esp)
+{
+    tcb->espacio = esp;
+    tcb->spsr.bits.M = MODE_USER;
+    tcb->sp_irq[1] = tcb->spsr.xPSR; // El frame inicial se armó con el SPSR de modo SYS
+}
+
+SECCION_TEXT void espacios_init(void)
+{
+    uint32_t i = 0;
+    mmu_espacio_t *esp;
+
+    // Lo que ven todas las tareas por igual queda global: texto, datos de usuario, página de tiempo y su timer
+    mmu_abrir_global((uint32_t)&_text_start_, (uint32_t)&_usuario_data_start_, MMU_AP_USR_RO, 0);
+    mmu_abrir_global((uint32_t)&_usuario_data_start_, (uint32_t)&_usuario_data_end_, MMU_AP_USR_RW, 1);
+    mmu_abrir_global((uint32_t)&_clock_page_start_, (uint32_t)&_clock_page_end_, MMU_AP_USR_RO, 1);
+    mmu_abrir_global(CLOCK_TIMER_ADDR, CLOCK_TIMER_ADDR + MMU_PAGINA_TAM, MMU_AP_USR_RO, 1);
+
+    // Lo que cambia de un espacio a otro queda no global en todas las tablas, también en la del kernel
+    mmu_marcar_privado((uint32_t)&_tareas_heap_start_, (uint32_t)&_tareas_heap_end_);
+    for (i = TASK_1; i <= TASK_3; i++)
+    {
+        mmu_marcar_privado(espacios_pila_inicio(i), espacios_pila_fin(i));
+    }
+#if STRESS_TAREAS > 0
+    mmu_marcar_privado((uint32_t)&_stress_stacks_sys_start_, (uint32_t)&_stress_stacks_sys_end_);
+#endif
+
+    for (i = TASK_1; i <= TASK_3; i++)
+    {
+        esp = &espacios[i - TASK_1];
+        mmu_espacio_crear(esp, espacios_tablas[i - TASK_1], MMU_ASID_KERNEL + 1U + (i - TASK_1));
+        mmu_espacio_abrir(esp, espacios_pila_inicio(i), espacios_pila_fin(i), MMU_AP_USR_RW);
+        mmu_espacio_abrir(esp, espacios_arena(i), espacios_arena(i) + HEAP_TAREA_TAM, MMU_AP_USR_RW);
+        espacios_usuario(&tcb_tareas.tareas[i], esp);
+    }
+#if STRESS_TAREAS > 0
+    esp = &espacios[ESPACIOS_CANT - 1U];
+    mmu_espacio_crear(esp, espacios_tablas[ESPACIOS_CANT - 1U], MMU_ASID_KERNEL + ESPACIOS_CANT);
+    mmu_espacio_abrir(esp, (uint32_t)&_stress_stacks_sys_start_, (uint32_t)&_stress_stacks_sys_end_, MMU_AP_USR_RW);
+    mmu_espacio_abrir(esp, espacios_arena(TASK_STRESS_BASE),
+                      espacios_arena(CANT_TASKS - 1U) + HEAP_TAREA_TAM, MMU_AP_USR_RW);
+    for (i = TASK_STRESS_BASE; i < CANT_TASKS; i++)
+    {
+        espacios_usuario(&tcb_tareas.tareas[i], esp);
+    }
+#endif
+
+    mmu_tablas_publicar();
+}
+
+SECCION_TEXT void espacios_activar(const tcb_t *tcb)
+{
+    mmu_espacio_activar(tcb->espacio);
+}
+
+SECCION_TEXT uint32_t C_abort_handler(uint32_t tipo, uint32_t spsr, uint32_t pc)
+{
+    uint32_t fsr;
+    uint32_t dir;
+
+    if (tipo == ABORT_DATOS)
+    {
+        __asm__ volatile("MRC p15, 0, %0, c5, c0, 0\n\t" // DFSR
+                         "MRC p15, 0, %1, c6, c0, 0"     // DFAR
+                         : "=r"(fsr), "=r"(dir));
+    }
+    else
+    {
+        __asm__ volatile("MRC p15, 0, %0, c5, c0, 1\n\t" // IFSR
+                         "MRC p15, 0, %1, c6, c0, 2"     // IFAR
+                         : "=r"(fsr), "=r"(dir));
+    }
+    kprint_str((tipo == ABORT_DATOS) ? "\n[mmu] data abort" : "\n[mmu] prefetch abort");
+    kprint_str(" pc=");
+    kprint_hex(pc);
+    kprint_str(" dir=");
+    kprint_hex(dir);
+    kprint_str(" fsr=");
+    kprint_hex(fsr);
+    if ((spsr & 0x1FU) != MODE_USER)
+    {
+        kprint_str(" en el kernel\n");
+#ifdef CONSOLA
+        consola_vaciar(0);
+#endif
+        halt_cpu();
+    }
+    kprint_str(" en la tarea ");
+    kprint_dec(scheduler_actual()->task_id);
+    kprint_str(": se termina\n");
+    // Sigue en modo usuario en un SVC de salida que no usa la pila (puede ser la que falló)
+    return (uint32_t)usuario_abortar;
+}
+
+#endif // AISLAMIENTO
+
+SECCION_TEXT uint32_t espacios_usuario_valido(const tcb_t *tcb, const void *ptr, uint32_t largo, uint32_t escribir)
+{
+    uint32_t ret = 1;
+
+#ifdef AISLAMIENTO
+    if (tcb->espacio != NULL)
+    {
+        ret = mmu_espacio_accesible(tcb->espacio, (uint32_t)ptr, largo, escribir);
+    }
+#else
+    (void)tcb;
+    (void)ptr;
+    (void)largo;
+    (void)escribir;
+#endif
+    return ret;
+}
+
+SECCION_TEXT int32_t espacios_usuario_cadena(const tcb_t *tcb, const char *s)
+{
+    int32_t len = 0;
+    uint32_t dir = (uint32_t)s;
+    uint32_t valido = (s != NULL) ? 1U : 0U;
+    uint8_t fin = 0;
+
+    while (valido == 1 && fin == 0)
+    {
+        // Una validación por página: la cadena puede cruzar a una que la tarea no tiene
+        if (len == 0 || (dir & (MMU_PAGINA_TAM - 1U)) == 0)
+        {
+            valido = espacios_usuario_valido(tcb, (const void *)dir, 1U, 0U);
+        }
+        if (valido == 1 && *(const char *)dir == '\0')
+        {
+            fin = 1;
+        }
+        else if (valido == 1)
+        {
+            dir++;
+            len++;
+        }
+    }
+    return (valido == 1) ? len : -1;
+}
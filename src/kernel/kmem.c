@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    kmem.c
+ * @brief   Implementación del asignador de memoria del kernel por slabs de tamaño fijo
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+__attribute__((section(".tcb_data"))) kmem_cache_t kmem_caches[KMEM_MAX_CACHES];
+__attribute__((section(".tcb_data"))) uint32_t kmem_cant_caches = 0;
+__attribute__((section(".tcb_data"))) uint8_t *kmem_heap_actual = NULL;
+__attribute__((section(".tcb_data"))) kmem_cache_t *kmem_clases[KMEM_CANT_CLASES];
+__attribute__((section(".tcb_data"))) spinlock_t kmem_lock = SPINLOCK_INIT;
+
+static const uint32_t kmem_tam_clases[KMEM_CANT_CLASES] = {16, 32, 64, 128, 256, 512};
+static const char *const kmem_nombres_clases[KMEM_CANT_CLASES] = {
+    "kmalloc-16", "kmalloc-32", "kmalloc-64", "kmalloc-128", "kmalloc-256", "kmalloc-512"};
+
+SECCION_TEXT static uint32_t kmem_alinear(uint32_t valor, uint32_t alineacion)
+{
+    return (valor + alineacion - 1) & ~(alineacion - 1);
+}
+
+SECCION_TEXT static kmem_slab_t *kmem_slab_nuevo(kmem_cache_t *cache)
+{
+    kmem_slab_t *slab = NULL;
+    // Los slabs nunca se devuelven al heap, así que no hay fragmentación externa
+    if ((uint32_t)kmem_heap_actual + KMEM_SLAB_SIZE <= (uint32_t)&_kernel_heap_end_)
+    {
+        slab = (kmem_slab_t *)kmem_heap_actual;
+        kmem_heap_actual += KMEM_SLAB_SIZE;
+        slab->cache = cache;
+        slab->sig = cache->slabs;
+        cache->slabs = slab;
+        cache->bump = (uint8_t *)slab + cache->offset;
+        cache->bump_fin = (uint8_t *)slab + KMEM_SLAB_SIZE;
+        cache->stats.slabs++;
+    }
+    return slab;
+}
+
+SECCION_TEXT void kmem_init(void)
+{
+    uint32_t i = 0;
+    kmem_cant_caches = 0;
+    kmem_heap_actual = (uint8_t *)kmem_alinear((uint32_t)&_kernel_heap_start_, KMEM_SLAB_SIZE);
+    for (i = 0; i < KMEM_CANT_CLASES; i++)
+    {
+        // Desde 64 bytes los objetos quedan alineados a línea de cache
+        kmem_clases[i] = kmem_cache_create(kmem_nombres_clases[i], kmem_tam_clases[i],
+                                           (kmem_tam_clases[i] >= KMEM_CACHE_LINE) ? KMEM_FLAG_LINEA : 0);
+    }
+}
+
+SECCION_TEXT kmem_cache_t *kmem_cache_create(const char *nombre, uint32_t tam, uint32_t flags)
+{
+    kmem_cache_t *cache = NULL;
+    uint32_t alineacion = sizeof(void *);
+    uint32_t irq_flags;
+
+    if ((flags & KMEM_FLAG_LINEA) != 0)
+    {
+        alineacion = KMEM_CACHE_LINE;
+    }
+    if (tam < sizeof(void *))
+    {
+        tam = sizeof(void *); // Cada objeto libre tiene que poder guardar el puntero al siguiente
+    }
+    tam = kmem_alinear(tam, alineacion);
+
+    irq_flags = spin_lock_irqsave(&kmem_lock);
+    if (kmem_cant_caches < KMEM_MAX_CACHES &&
+        kmem_alinear(sizeof(kmem_slab_t), alineacion) + tam <= KMEM_SLAB_SIZE)
+    {
+        cache = &kmem_caches[kmem_cant_caches];
+        kmem_cant_caches++;
+        cache->nombre = nombre;
+        cache->tam_objeto = tam;
+        cache->offset = kmem_alinear(sizeof(kmem_slab_t), alineacion);
+        cache->libres = NULL;
+        cache->bump = NULL;
+        cache->bump_fin = NULL;
+        cache->slabs = NULL;
+        cache->stats.allocs = 0;
+        cache->stats.frees = 0;
+        cache->stats.en_uso = 0;
+        cache->stats.max_en_uso = 0;
+        cache->stats.slabs = 0;
+        cache->stats.fallos = 0;
+    }
+    spin_unlock_irqrestore(&kmem_lock, irq_flags);
+    return cache;
+}
+
+SECCION_TEXT void *kmem_cache_alloc(kmem_cache_t *cache)
+{
+    void *obj = NULL;
+    uint32_t irq_flags;
+
+    if (cache != NULL)
+    {
+        irq_flags = spin_lock_irqsave(&kmem_lock);
+        if (cache->libres != NULL)
+        {
+            // Caso común: saco el primero de la lista libre
+            obj = cache->libres;
+            cache->libres = *(void **)obj;
+        }
+        else if ((cache->bump != NULL && cache->bump + cache->tam_objeto <= cache->bump_fin) ||
+                 kmem_slab_nuevo(cache) != NULL)
+        {
+            // Los slabs se reparten de a un objeto, así que tomar uno nuevo también es O(1)
+            obj = cache->bump;
+            cache->bump += cache->tam_objeto;
+        }
+
+        if (obj != NULL)
+        {
+            cache->stats.allocs++;
+            cache->stats.en_uso++;
+            if (cache->stats.en_uso > cache->stats.max_en_uso)
+            {
+                cache->stats.max_en_uso = cache->stats.en_uso;
+            }
+        }
+        else
+        {
+            cache->stats.fallos++;
+        }
+        spin_unlock_irqrestore(&kmem_lock, irq_flags);
+    }
+    return obj;
+}
+
+SECCION_TEXT void kmem_cache_free(kmem_cache_t *cache, void *obj)
+{
+    uint32_t irq_flags;
+    if (cache != NULL && obj != NULL)
+    {
+        irq_flags = spin_lock_irqsave(&kmem_lock);
+        *(void **)obj = cache->libres;
+        cache->libres = obj;
+        cache->stats.frees++;
+        cache->stats.en_uso--;
+        spin_unlock_irqrestore(&kmem_lock, irq_flags);
+    }
+}
+
+SECCION_TEXT void *kmalloc(size_t tam)
+{
+    void *ptr = NULL;
+    uint32_t i = 0;
+    uint8_t encontrado = 0;
+    for (i = 0; i < KMEM_CANT_CLASES && encontrado == 0; i++)
+    {
+        if (tam <= kmem_tam_clases[i])
+        {
+            ptr = kmem_cache_alloc(kmem_clases[i]);
+            encontrado = 1;
+        }
+    }
+    return ptr;
+}
+
+SECCION_TEXT void kfree(void *ptr)
+{
+    kmem_slab_t *slab;
+    if (ptr != NULL && (uint32_t)ptr >= (uint32_t)&_kernel_heap_start_ &&
+        (uint32_t)ptr < (uint32_t)&_kernel_heap_end_)
+    {
+        // El encabezado del slab está al principio de la página que contiene al objeto
+        slab = (kmem_slab_t *)((uint32_t)ptr & ~(KMEM_SLAB_SIZE - 1));
+        kmem_cache_free(slab->cache, ptr);
+    }
+}
+
+SECCION_TEXT void kmem_report(void)
+{
+    uint32_t i = 0;
+    kmem_cache_t *cache;
+
+    kprint_str("[kmem] cache           obj  allocs   frees  en_uso     max  slabs fallos\n");
+    for (i = 0; i < kmem_cant_caches; i++)
+    {
+        cache = &kmem_caches[i];
+        kprint_str("[kmem] ");
+        kprint_str(cache->nombre);
+        kprint_str(" ");
+        kprint_dec_ancho(cache->tam_objeto, 5);
+        kprint_dec_ancho(cache->stats.allocs, 8);
+        kprint_dec_ancho(cache->stats.frees, 8);
+        kprint_dec_ancho(cache->stats.en_uso, 8);
+        kprint_dec_ancho(cache->stats.max_en_uso, 8);
+        kprint_dec_ancho(cache->stats.slabs, 7);
+        kprint_dec_ancho(cache->stats.fallos, 7);
+        kprint_str("\n");
+    }
+    kprint_str("[kmem] heap libre: ");
+    kprint_dec((uint32_t)&_kernel_heap_end_ - (uint32_t)kmem_heap_actual);
+    kprint_str(" bytes\n");
+}
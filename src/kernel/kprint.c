@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    kprint.c
+ * @brief   Implementación de funciones de impresión por UART desde el kernel
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+// El Cortex-A8 no tiene división por hardware: se convierte restando potencias de 10
+static const uint32_t potencias_10[] = {1000000000U, 100000000U, 10000000U, 1000000U, 100000U,
+                                        10000U, 1000U, 100U, 10U, 1U};
+
+SECCION_TEXT void kprint_str(const char *str)
+{
+    sys_my_printf(str);
+}
+
+SECCION_TEXT void kprint_dec_ancho(uint32_t num, uint32_t ancho)
+{
+    char buf[11];
+    uint32_t i = 0;
+    uint32_t j = 0;
+    uint32_t digitos = 0;
+    char digito;
+
+    for (i = 0; i < 10; i++)
+    {
+        digito = '0';
+        while (num >= potencias_10[i])
+        {
+            num -= potencias_10[i];
+            digito++;
+        }
+        if (digito != '0' || j > 0 || i == 9)
+        {
+            buf[j] = digito;
+            j++;
+        }
+    }
+    buf[j] = '\0';
+
+    digitos = j;
+    while (digitos < ancho)
+    {
+        kprint_str(" ");
+        digitos++;
+    }
+    kprint_str(buf);
+}
+
+SECCION_TEXT void kprint_dec(uint32_t num)
+{
+    kprint_dec_ancho(num, 0);
+}
+
+SECCION_TEXT void kprint_hex(uint32_t num)
+{
+    char buf[11];
+    uint32_t i = 0;
+    uint32_t nibble;
+
+    buf[0] = '0';
+    buf[1] = 'x';
+    for (i = 0; i < 8; i++)
+    {
+        nibble = (num >> (28 - 4 * i)) & 0xFU;
+        buf[2 + i] = (nibble < 10) ? (char)('0' + nibble) : (char)('A' + nibble - 10);
+    }
+    buf[10] = '\0';
+    kprint_str(buf);
+}
+
+SECCION_TEXT uint32_t kdiv(uint32_t num, uint32_t den)
+{
+    uint32_t cociente = 0;
+    uint32_t resto = 0;
+    uint32_t desborde = 0;
+    int32_t i = 0;
+
+    // Restas sucesivas bit a bit, del más significativo al menos
+    for (i = 31; i >= 0 && den != 0; i--)
+    {
+        desborde = resto >> 31; // Con den > 2^31 el resto desplazado no entra en 32 bits
+        resto = (resto << 1) | ((num >> i) & 1U);
+        if (desborde != 0 || resto >= den)
+        {
+            resto -= den;
+            cociente |= 1U << i;
+        }
+    }
+    return cociente;
+}
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    rt.c
+ * @brief   Implementación de la planificación de tiempo real (EDF / rate monotonic)
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+extern tcb_context_t tcb_tareas;
+
+__attribute__((section(".tcb_data"))) rt_tarea_t rt_tareas[CANT_TASKS];
+__attribute__((section(".tcb_data"))) uint32_t rt_ticks = 0;
+__attribute__((section(".tcb_data"))) uint32_t rt_utilizacion_total = 0;
+__attribute__((section(".tcb_data"))) uint32_t rt_cant_tareas = 0;
+__attribute__((section(".tcb_data"))) uint32_t rt_ticks_reporte = 0;
+
+// Cota de Liu y Layland n(2^(1/n) - 1) en por mil, para n = 1..8
+static const uint32_t rt_cota_rm[] = {1000, 828, 779, 756, 743, 734, 728, 724};
+#define RT_COTA_RM_LIMITE 693 // ln(2) para n grande
+
+// Comparación de ticks absolutos tolerante a la vuelta del contador
+#define RT_ANTES(a, b) ((int32_t)((a) - (b)) < 0)
+
+#if RT_REPORT_TICKS > 0
+SECCION_TEXT static void rt_report_work_fn(void *arg)
+{
+    (void)arg;
+    rt_report();
+}
+__attribute__((section(".tcb_data"))) static work_t rt_report_work = WORK_INIT(rt_report_work_fn, NULL);
+#endif
+
+SECCION_TEXT void rt_init(void)
+{
+    uint32_t i = 0;
+    for (i = 0; i < CANT_TASKS; i++)
+    {
+        rt_tareas[i].estado = RT_INACTIVA;
+        rt_tareas[i].activaciones = 0;
+        rt_tareas[i].completados = 0;
+        rt_tareas[i].deadline_misses = 0;
+        rt_tareas[i].overruns = 0;
+        rt_tareas[i].peor_respuesta_us = 0;
+    }
+    rt_ticks = 0;
+    rt_ticks_reporte = 0;
+    rt_utilizacion_total = 0;
+    rt_cant_tareas = 0;
+}
+
+SECCION_TEXT int rt_admitir(uint32_t task_id, uint32_t periodo, uint32_t wcet, uint32_t deadline)
+{
+    int ret = -1;
+    uint32_t utilizacion;
+    uint32_t cota = 1000;
+    rt_tarea_t *rt;
+
+    if (task_id < CANT_TASKS && periodo > 0 && wcet > 0 && deadline >= wcet && deadline <= periodo)
+    {
+        rt = &rt_tareas[task_id];
+        // Con deadline < período se usa la densidad wcet / deadline (test suficiente).
+        // Redondeada hacia arriba: truncar dejaría pasar conjuntos que superan la cota por menos de 1/1000
+        utilizacion = kdiv(wcet * 1000U + deadline - 1U, deadline);
+#ifdef SCHED_RM
+        cota = (rt_cant_tareas < 8) ? rt_cota_rm[rt_cant_tareas] : RT_COTA_RM_LIMITE;
+#endif
+        if (rt->estado == RT_INACTIVA && rt_utilizacion_total + utilizacion <= cota)
+        {
+            rt->periodo = periodo;
+            rt->wcet = wcet;
+            rt->deadline = deadline;
+            rt->utilizacion = utilizacion;
+            rt->estado = RT_ESPERANDO;
+            rt->miss_contado = 1;
+            rt->proxima_activacion = rt_ticks; // Primera activación en el próximo tick
+            rt->deadline_abs = rt_ticks;
+            rt->budget = 0;
+            rt_utilizacion_total += utilizacion;
+            rt_cant_tareas++;
+            ret = 0;
+        }
+        else
+        {
+            kprint_str("[rt] tarea ");
+            kprint_dec(task_id);
+            kprint_str(" rechazada: U = ");
+            kprint_dec(rt_utilizacion_total + utilizacion);
+            kprint_str(" > ");
+            kprint_dec(cota);
+            kprint_str(" por mil\n");
+        }
+    }
+    return ret;
+}
+
+SECCION_TEXT uint32_t rt_es_tiempo_real(uint32_t task_id)
+{
+    uint32_t ret = 0;
+    if (task_id < CANT_TASKS && rt_tareas[task_id].estado != RT_INACTIVA)
+    {
+        ret = 1;
+    }
+    return ret;
+}
+
+SECCION_TEXT void rt_tick(tcb_t *actual)
+{
+    uint32_t i = 0;
+    rt_tarea_t *rt;
+
+    rt_ticks++;
+
+    // Presupuesto del trabajo que ocupó este tick
+    if (rt_es_tiempo_real(actual->task_id) == 1)
+    {
+        rt = &rt_tareas[actual->task_id];
+        if (rt->estado == RT_LISTA && rt->budget > 0)
+        {
+            rt->budget--;
+            if (rt->budget == 0)
+            {
+                rt->overruns++;
+                rt->estado = RT_AGOTADA;
+            }
+        }
+    }
+
+    for (i = 0; i < CANT_TASKS; i++)
+    {
+        rt = &rt_tareas[i];
+        if (rt->estado != RT_INACTIVA)
+        {
+            // Deadline vencido con el trabajo sin terminar
+            if (rt->estado != RT_ESPERANDO && rt->miss_contado == 0 && !RT_ANTES(rt_ticks, rt->deadline_abs))
+            {
+                rt->deadline_misses++;
+                rt->miss_contado = 1;
+                KBITACORA_AVISO("[rt] tarea %u: deadline perdido en el tick %u\n", i, rt_ticks);
+            }
+            // Activación de un nuevo trabajo
+            if (!RT_ANTES(rt_ticks, rt->proxima_activacion))
+            {
+                rt->estado = RT_LISTA;
+                rt->budget = rt->wcet;
+                rt->deadline_abs = rt->proxima_activacion + rt->deadline;
+                rt->proxima_activacion += rt->periodo;
+                rt->inicio_trabajo = clock_ciclos();
+                rt->miss_contado = 0;
+                rt->activaciones++;
+            }
+        }
+    }
+
+#if RT_REPORT_TICKS > 0
+    rt_ticks_reporte++;
+    if (rt_ticks_reporte >= RT_REPORT_TICKS)
+    {
+        rt_ticks_reporte = 0;
+        workqueue_encolar(&rt_report_work); // Se imprime desde la worker, no desde el tick
+    }
+#endif
+}
+
+SECCION_TEXT tcb_t *rt_elegir(void)
+{
+    uint32_t i = 0;
+    tcb_t *elegida = NULL;
+    rt_tarea_t *mejor = NULL;
+    rt_tarea_t *rt;
+
+    for (i = 0; i < CANT_TASKS; i++)
+    {
+        rt = &rt_tareas[i];
+        if (rt->estado == RT_LISTA && tcb_tareas.tareas[i].estado == TAREA_LISTA)
+        {
+#ifdef SCHED_RM
+            // Rate monotonic: prioridad fija, gana el período más corto
+            if (mejor == NULL || rt->periodo < mejor->periodo)
+#else
+            // EDF: gana el deadline absoluto más cercano
+            if (mejor == NULL || RT_ANTES(rt->deadline_abs, mejor->deadline_abs))
+#endif
+            {
+                mejor = rt;
+                elegida = &tcb_tareas.tareas[i];
+            }
+        }
+    }
+    return elegida;
+}
+
+SECCION_TEXT int sys_rt_esperar(uint32_t task_id)
+{
+    int ret = 0;
+    uint32_t respuesta;
+    rt_tarea_t *rt;
+
+    if (rt_es_tiempo_real(task_id) == 1)
+    {
+        rt = &rt_tareas[task_id];
+        if (rt->estado == RT_LISTA)
+        {
+            // Fin del trabajo: tiempo de respuesta en us (el clocksource corre a 1 MHz)
+            respuesta = clock_ciclos() - rt->inicio_trabajo;
+            if (respuesta > rt->peor_respuesta_us)
+            {
+                rt->peor_respuesta_us = respuesta;
+            }
+            rt->completados++;
+            rt->estado = RT_ESPERANDO;
+            ret = 1;
+        }
+        else
+        {
+            ret = 1; // Agotó su presupuesto: espera igual la próxima activación
+        }
+    }
+    return ret;
+}
+
+SECCION_TEXT void rt_report(void)
+{
+    uint32_t i = 0;
+    rt_tarea_t *rt;
+
+    kprint_str("[rt] tarea  T  C  D   activ  compl  misses overruns peor_resp_us\n");
+    for (i = 0; i < CANT_TASKS; i++)
+    {
+        rt = &rt_tareas[i];
+        if (rt->estado != RT_INACTIVA)
+        {
+            kprint_str("[rt] ");
+            kprint_dec_ancho(i, 5);
+            kprint_dec_ancho(rt->periodo, 3);
+            kprint_dec_ancho(rt->wcet, 3);
+            kprint_dec_ancho(rt->deadline, 3);
+            kprint_dec_ancho(rt->activaciones, 8);
+            kprint_dec_ancho(rt->completados, 7);
+            kprint_dec_ancho(rt->deadline_misses, 8);
+            kprint_dec_ancho(rt->overruns, 9);
+            kprint_dec_ancho(rt->peor_respuesta_us, 13);
+            kprint_str("\n");
+        }
+    }
+}
@@ -29,13 +29,22 @@
 #include "defines.h"
 
 __attribute__((section(".tcb_data"))) tcb_context_t tcb_tareas;
+// Ticks de la CPU0 y tareas dormidas con SYS_SLEEP_TICKS
+__attribute__((section(".tcb_data"))) static uint32_t scheduler_ticks;
+__attribute__((section(".tcb_data"))) static uint32_t scheduler_dormidas;
+__attribute__((section(".tcb_data"))) static spinlock_t scheduler_dormidas_lock = SPINLOCK_INIT;
+// Ordena el despertar de una tarea contra su salida de la CPU (en_cpu)
+__attribute__((section(".tcb_data"))) static spinlock_t scheduler_cambio_lock = SPINLOCK_INIT;
+// Región de heap de cada tarea; la arena va al principio (ver user/heap.h)
+__attribute__((section(".tareas_heap"), aligned(4096))) static uint8_t scheduler_heaps[CANT_TASKS][HEAP_TAREA_TAM];
 
-__attribute__((section(".text"))) void scheduler_init(void)
+SECCION_TEXT void scheduler_tcb_init(tcb_t *tcb, task_id_t task_id, uint32_t ticks, void (*tarea)(void),
+                                     uint32_t *kernel_top, uint32_t *sys_top)
 {
     uint32_t i = 0;
     uint32_t *ptr;
     xPSR_t spsr = {.bits = {.M = MODE_SYS,
-                            .T = 0,
+                            .T = (uint32_t)tarea & 1U, // Punto de entrada Thumb: bit 0 en 1
                             .F = 0,
                             .I = 0,
                             .A = 0,
@@ -50,144 +59,494 @@ __attribute__((section(".text"))) void scheduler_init(void)
                             .C = 0,
                             .Z = 1,
                             .N = 0}};
-    tcb_tareas.task_id_actual = TASK_IDLE;
-    tcb_tareas.run = 0;
-
-    ptr = &_tareaidle_irq_stack_top_ - 16;  // 16 palabras para contexto (full descending)
-    tcb_tareas.tareas[TASK_IDLE].ticks = 5; // Ticks para la tarea idle
-    tcb_tareas.tareas[TASK_IDLE].ticks_actuales = 0;
-    tcb_tareas.tareas[TASK_IDLE].ptr_tarea = tarea_idle;
-    tcb_tareas.tareas[TASK_IDLE].task_id = TASK_IDLE;
-    tcb_tareas.tareas[TASK_IDLE].spsr = spsr;
-    tcb_tareas.tareas[TASK_IDLE].sp_irq = ptr;
-    tcb_tareas.tareas[TASK_IDLE].sp_svc = &_tareaidle_svc_stack_top_;
-    tcb_tareas.tareas[TASK_IDLE].sp_sys = &_tareaidle_sys_stack_top_; // Asignar el mismo stack para SVC y SYS
-    tcb_tareas.tareas[TASK_IDLE].lr_svc = NULL;
-    tcb_tareas.tareas[TASK_IDLE].lr_sys = (uint32_t *)tarea_idle;
+
+    ptr = kernel_top - 16; // 16 palabras para contexto (full descending) en la pila de kernel
+    tcb->ticks = ticks;
+    tcb->ticks_actuales = 0;
+    tcb->ptr_tarea = tarea;
+    tcb->task_id = task_id;
+    tcb->estado = TAREA_LISTA;
+    tcb->spsr = spsr;
+    tcb->sp_irq = ptr;
+    tcb->sp_sys = sys_top;
+    tcb->lr_sys = (uint32_t *)tarea;
+    tcb->dormir_hasta = 0;
+    tcb->despertada = 0;
+    tcb->en_cpu = 0;
+    tcb->tls = heap_arena_init(scheduler_heaps[task_id], HEAP_TAREA_TAM);
+    tcb->espacio = NULL;
+    ptr[-2] = 0; // Relleno y LR de SVC debajo del frame
+    ptr[-1] = 0;
     ptr[0] = (uint32_t)(ptr + 2);
-    ptr[1] = tcb_tareas.tareas[TASK_IDLE].spsr.xPSR; // Guardar el xPSR en el stack
+    ptr[1] = tcb->spsr.xPSR; // Guardar el xPSR en el stack
     for (i = 2; i < 15; i++)
     {
         ptr[i] = 0; // Inicializar los registros R0-R12
     }
-    ptr[15] = (uint32_t)tcb_tareas.tareas[TASK_IDLE].ptr_tarea; // LR
-
-    // Tarea 1
-    ptr = &_tarea1_irq_stack_top_ - 16;
-    tcb_tareas.tareas[TASK_1].ticks = 8;
-    tcb_tareas.tareas[TASK_1].ticks_actuales = 0;
-    tcb_tareas.tareas[TASK_1].ptr_tarea = tarea1;
-    tcb_tareas.tareas[TASK_1].task_id = TASK_1;
-    tcb_tareas.tareas[TASK_1].spsr = spsr;
-    tcb_tareas.tareas[TASK_1].sp_irq = ptr;
-    tcb_tareas.tareas[TASK_1].sp_svc = &_tarea1_svc_stack_top_;
-    tcb_tareas.tareas[TASK_1].sp_sys = &_tarea1_sys_stack_top_; // Asignar el mismo stack para SVC y SYS
-    tcb_tareas.tareas[TASK_1].lr_svc = NULL;
-    tcb_tareas.tareas[TASK_1].lr_sys = (uint32_t *)tarea1;
-    ptr[0] = (uint32_t)(ptr + 2);
-    ptr[1] = tcb_tareas.tareas[TASK_1].spsr.xPSR;
-    for (i = 2; i < 15; i++)
+    ptr[15] = (uint32_t)tcb->ptr_tarea & ~1U; // LR; el estado lo da SPSR.T
+}
+
+SECCION_TEXT static void runqueue_push(runqueue_t *rq, task_id_t task_id)
+{
+    uint32_t idx;
+    spin_lock(&rq->lock);
+    if (rq->cant < CANT_TASKS)
     {
-        ptr[i] = 0;
-    }
-    ptr[15] = (uint32_t)tcb_tareas.tareas[TASK_1].ptr_tarea;
-
-    // Tarea 2
-    ptr = &_tarea2_irq_stack_top_ - 16;
-    tcb_tareas.tareas[TASK_2].ticks = 12;
-    tcb_tareas.tareas[TASK_2].ticks_actuales = 0;
-    tcb_tareas.tareas[TASK_2].ptr_tarea = tarea2;
-    tcb_tareas.tareas[TASK_2].task_id = TASK_2;
-    tcb_tareas.tareas[TASK_2].spsr = spsr;
-    tcb_tareas.tareas[TASK_2].sp_irq = ptr;
-    tcb_tareas.tareas[TASK_2].sp_svc = &_tarea2_svc_stack_top_;
-    tcb_tareas.tareas[TASK_2].sp_sys = &_tarea2_sys_stack_top_; // Asignar el mismo stack para SVC y SYS
-    tcb_tareas.tareas[TASK_2].lr_svc = NULL;
-    tcb_tareas.tareas[TASK_2].lr_sys = (uint32_t *)tarea2;
-    ptr[0] = (uint32_t)(ptr + 2);
-    ptr[1] = tcb_tareas.tareas[TASK_2].spsr.xPSR;
-    for (i = 2; i < 15; i++)
+        idx = rq->inicio + rq->cant;
+        if (idx >= CANT_TASKS)
+        {
+            idx -= CANT_TASKS;
+        }
+        rq->cola[idx] = task_id;
+        rq->cant++;
+    }
+    spin_unlock(&rq->lock);
+}
+
+SECCION_TEXT static tcb_t *runqueue_pop(runqueue_t *rq)
+{
+    tcb_t *tcb = NULL;
+    spin_lock(&rq->lock);
+    if (rq->cant > 0)
     {
-        ptr[i] = 0;
-    }
-    ptr[15] = (uint32_t)tcb_tareas.tareas[TASK_2].ptr_tarea;
-
-    // Tarea 3
-    ptr = &_tarea3_irq_stack_top_ - 16;
-    tcb_tareas.tareas[TASK_3].ticks = 5;
-    tcb_tareas.tareas[TASK_3].ticks_actuales = 0;
-    tcb_tareas.tareas[TASK_3].ptr_tarea = tarea3;
-    tcb_tareas.tareas[TASK_3].task_id = TASK_3;
-    tcb_tareas.tareas[TASK_3].spsr = spsr;
-    tcb_tareas.tareas[TASK_3].sp_irq = ptr;
-    tcb_tareas.tareas[TASK_3].sp_svc = &_tarea3_svc_stack_top_;
-    tcb_tareas.tareas[TASK_3].sp_sys = &_tarea3_sys_stack_top_; // Asignar el mismo stack para SVC y SYS
-    tcb_tareas.tareas[TASK_3].lr_svc = NULL;
-    tcb_tareas.tareas[TASK_3].lr_sys = (uint32_t *)tarea3;
-    ptr[0] = (uint32_t)(ptr + 2);
-    ptr[1] = tcb_tareas.tareas[TASK_3].spsr.xPSR;
-    for (i = 2; i < 15; i++)
+        tcb = &tcb_tareas.tareas[rq->cola[rq->inicio]];
+        rq->inicio++;
+        if (rq->inicio >= CANT_TASKS)
+        {
+            rq->inicio = 0;
+        }
+        rq->cant--;
+    }
+    spin_unlock(&rq->lock);
+    return tcb;
+}
+
+SECCION_TEXT static tcb_t *runqueue_robar(uint32_t cpu_local)
+{
+    tcb_t *tcb = NULL;
+    runqueue_t *rq;
+    uint32_t i = 0;
+    uint32_t victima = cpu_local;
+    uint32_t max = 0;
+    uint32_t idx;
+
+    // La víctima es la CPU con la cola más larga; se le roba la última tarea encolada
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        if (i != cpu_local && tcb_tareas.cpus[i].rq.cant > max)
+        {
+            max = tcb_tareas.cpus[i].rq.cant;
+            victima = i;
+        }
+    }
+    if (victima != cpu_local)
     {
-        ptr[i] = 0;
+        rq = &tcb_tareas.cpus[victima].rq;
+        spin_lock(&rq->lock);
+        if (rq->cant > 0)
+        {
+            rq->cant--;
+            idx = rq->inicio + rq->cant;
+            if (idx >= CANT_TASKS)
+            {
+                idx -= CANT_TASKS;
+            }
+            tcb = &tcb_tareas.tareas[rq->cola[idx]];
+            tcb_tareas.cpus[cpu_local].robos++;
+        }
+        spin_unlock(&rq->lock);
     }
-    ptr[15] = (uint32_t)tcb_tareas.tareas[TASK_3].ptr_tarea;
+    return tcb;
 }
 
-__attribute__((section(".text"))) void scheduler(void)
+SECCION_TEXT void scheduler_init(void)
 {
-    tcb_t *actual = &tcb_tareas.tareas[tcb_tareas.task_id_actual];
-    actual->ticks_actuales++;
-    if (tcb_tareas.run != 1)
+    uint32_t i = 0;
+    uint32_t cpu = 0;
+    cpu_t *c;
+
+    // Pintar las pilas antes de armar los contextos iniciales
+    stack_monitor_init();
+
+    scheduler_tcb_init(&tcb_tareas.tareas[TASK_IDLE], TASK_IDLE, 5, tarea_idle, &_tareaidle_svc_stack_top_,
+                       &_tareaidle_sys_stack_top_);
+    scheduler_tcb_init(&tcb_tareas.tareas[TASK_1], TASK_1, 8, tarea1, &_tarea1_svc_stack_top_,
+                       &_tarea1_sys_stack_top_);
+    scheduler_tcb_init(&tcb_tareas.tareas[TASK_2], TASK_2, 12, tarea2, &_tarea2_svc_stack_top_,
+                       &_tarea2_sys_stack_top_);
+    scheduler_tcb_init(&tcb_tareas.tareas[TASK_3], TASK_3, 5, tarea3, &_tarea3_svc_stack_top_,
+                       &_tarea3_sys_stack_top_);
+    scheduler_tcb_init(&tcb_tareas.tareas[TASK_WORKER], TASK_WORKER, 5, tarea_worker, &_tareaworker_svc_stack_top_,
+                       &_tareaworker_sys_stack_top_);
+#if STRESS_TAREAS > 0
+    stress_init();
+#endif
+#ifdef AISLAMIENTO
+    espacios_init();
+#endif
+    scheduler_ticks = 0;
+    scheduler_dormidas = 0;
+
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        c = &tcb_tareas.cpus[i];
+        // El contexto idle de la CPU se guarda en el primer tick (es el contexto de arranque)
+        c->idle.ticks = 1;
+        c->idle.ticks_actuales = 0;
+        c->idle.ptr_tarea = halt_cpu;
+        c->idle.task_id = TASK_INIT;
+        c->idle.estado = TAREA_LISTA;
+        c->idle.dormir_hasta = 0;
+        c->idle.despertada = 0;
+        c->idle.en_cpu = 0;
+        c->idle.tls = NULL;
+        c->idle.espacio = NULL;
+        c->actual = &c->idle;
+        // La CPU0 usa la tarea idle (mide las pilas); las demás vuelven a su contexto de arranque
+        c->ocioso = (i == 0) ? &tcb_tareas.tareas[TASK_IDLE] : &c->idle;
+        c->rq.inicio = 0;
+        c->rq.cant = 0;
+        c->rq.lock.lock = 0;
+        c->run = 0;
+        c->resched = 0;
+        c->saliente = NULL;
+        c->cambios = 0;
+        c->robos = 0;
+        c->ticks_ocupados = 0;
+        c->ticks_ociosos = 0;
+    }
+
+    rt_init();
+#ifdef SCHED_RT
+    // Período, WCET y deadline en ticks. Las tareas no admitidas corren en segundo plano.
+    rt_admitir(TASK_1, 20, 8, 20);
+    rt_admitir(TASK_2, 40, 12, 40);
+    rt_admitir(TASK_3, 25, 5, 25);
+#endif
+
+    // Reparto inicial de las tareas entre las CPUs, en orden. La idle y las de tiempo real no usan la cola.
+    for (i = TASK_1; i < CANT_TASKS; i++)
     {
-        tcb_tareas.run = 1; // Ver si hace falta
+        if (rt_es_tiempo_real(i) == 0)
+        {
+            runqueue_push(&tcb_tareas.cpus[cpu].rq, (task_id_t)i);
+            cpu++;
+            if (cpu >= CANT_CPUS)
+            {
+                cpu = 0;
+            }
+        }
+    }
+}
+
+SECCION_TEXT tcb_t *scheduler_actual(void)
+{
+    return tcb_tareas.cpus[cpu_id()].actual;
+}
+
+SECCION_TEXT static uint8_t scheduler_encolable(cpu_t *cpu, tcb_t *tcb)
+{
+    return (tcb != cpu->ocioso && tcb->task_id < CANT_TASKS && tcb->estado == TAREA_LISTA &&
+            rt_es_tiempo_real(tcb->task_id) == 0) ? 1U : 0U;
+}
+
+SECCION_TEXT static void scheduler_salir(cpu_t *cpu, tcb_t *actual, tcb_t *next)
+{
+    cpu->cambios++;
+    next->en_cpu = 1;
+    // Lista o bloqueada, sigue en la CPU hasta scheduler_fin_cambio: ahí se libera y, si está lista, se encola
+    if (actual != cpu->ocioso && actual->task_id < CANT_TASKS)
+    {
+        cpu->saliente = actual;
+    }
+}
+
+SECCION_TEXT static void scheduler_avisar_ociosas(uint32_t id)
+{
+    uint32_t i = 0;
+    cpu_t *cpu = &tcb_tareas.cpus[id];
+
+    // Si quedó trabajo en la cola y hay CPUs ociosas, se les avisa para que roben
+    for (i = 0; i < CANT_CPUS && cpu->rq.cant > 0; i++)
+    {
+        if (i != id && tcb_tareas.cpus[i].actual == tcb_tareas.cpus[i].ocioso)
+        {
+            smp_send_resched(i);
+        }
+    }
+}
+
+SECCION_TEXT static void scheduler_elegir(uint32_t id, uint8_t forzar)
+{
+    cpu_t *cpu = &tcb_tareas.cpus[id];
+    tcb_t *actual = cpu->actual;
+    tcb_t *next = NULL;
+
+    if (actual->estado != TAREA_LISTA)
+    {
+        forzar = 1; // La tarea actual se bloqueó
+    }
+
+#ifdef SCHED_RT
+    next = rt_elegir();
+    if (next != NULL)
+    {
+        // Una tarea de tiempo real lista siempre desaloja a las de segundo plano
+        if (next != actual && scheduler_encolable(cpu, actual) == 1)
+        {
+            actual->ticks_actuales = 0;
+        }
+        if (next != actual)
+        {
+            scheduler_salir(cpu, actual, next);
+        }
+        cpu->actual = next;
     }
-    if (actual->ticks_actuales >= actual->ticks)
+    else if (rt_es_tiempo_real(actual->task_id) == 1)
     {
-        tcb_tareas.task_id_actual++;
+        forzar = 1; // La tarea de tiempo real terminó o agotó su WCET
+    }
+#endif
+
+    // La tarea ociosa solo corre mientras no haya nada listo: cualquier tick la reevalúa
+    if (next == NULL && (actual->ticks_actuales >= actual->ticks || cpu->resched != 0 || forzar != 0 ||
+                         actual == cpu->ocioso || actual == &cpu->idle))
+    {
+        cpu->resched = 0;
         actual->ticks_actuales = 0; // Reiniciar los ticks actuales
-        if (tcb_tareas.task_id_actual >= CANT_TASKS)
+        // La saliente no se encola todavía: la CPU sigue corriendo sobre su pila de kernel
+        // hasta que handlers.s pasa a la de la entrante (ver scheduler_fin_cambio)
+        next = runqueue_pop(&cpu->rq);
+        if (next == NULL)
+        {
+            // Cola vacía: robo trabajo de otra CPU antes de quedar ociosa
+            next = runqueue_robar(id);
+        }
+        if (next == NULL && scheduler_encolable(cpu, actual) == 1)
         {
-            tcb_tareas.task_id_actual = TASK_IDLE; // Volver a la tarea idle si se supera el límite
+            next = actual; // No hay otra lista: sigue la misma
         }
+        if (next == NULL)
+        {
+            next = cpu->ocioso;
+        }
+        if (next != actual)
+        {
+            scheduler_salir(cpu, actual, next);
+        }
+        cpu->actual = next;
+        scheduler_avisar_ociosas(id);
     }
+
+#if STRESS_TAREAS > 0
+    if (cpu->actual->despertada != 0)
+    {
+        stress_latencia(cpu->actual);
+    }
+#endif
 }
 
-__attribute__((section(".text"))) void save_context(tcb_t *tcb, uint32_t *sp_irq)
+SECCION_TEXT void scheduler_tick(void)
+{
+    cpu_t *cpu = &tcb_tareas.cpus[cpu_id()];
+    tcb_t *actual = cpu->actual;
+
+    actual->ticks_actuales++;
+    if (actual == cpu->ocioso || actual == &cpu->idle)
+    {
+        cpu->ticks_ociosos++;
+    }
+    else
+    {
+        cpu->ticks_ocupados++;
+    }
+
+#ifdef SCHED_RT
+    rt_tick(actual);
+#endif
+}
+
+SECCION_TEXT void scheduler_replanificar(void)
+{
+    uint32_t id = cpu_id();
+
+    tcb_tareas.cpus[id].run = 1;
+    scheduler_elegir(id, 0);
+}
+
+SECCION_TEXT uint32_t *scheduler_yield(uint32_t *frame_svc)
+{
+    uint32_t id = cpu_id();
+    cpu_t *cpu = &tcb_tareas.cpus[id];
+    tcb_t *actual = cpu->actual;
+    tcb_t *next;
+    uint32_t *ret = frame_svc;
+
+    if (cpu->run == 1)
+    {
+#if STRESS_TAREAS > 0
+        stress_sched_entrada();
+#endif
+        // Como en tick_handler: el contexto queda guardado antes de que la tarea pueda cambiar de dueño
+        save_context(actual, frame_svc);
+        stack_check_canary(actual->task_id);
+        scheduler_elegir(id, 1);
+        next = cpu->actual;
+        if (next != actual)
+        {
+            context_switch(next, &ret);
+        }
+#if STRESS_TAREAS > 0
+        stress_sched_salida();
+#endif
+    }
+    return ret;
+}
+
+SECCION_TEXT void scheduler_fin_cambio(void)
+{
+    uint32_t id = cpu_id();
+    cpu_t *cpu = &tcb_tareas.cpus[id];
+    tcb_t *saliente = cpu->saliente;
+    uint32_t irq_flags;
+
+    if (saliente != NULL)
+    {
+        cpu->saliente = NULL;
+        // Bajo el mismo lock que scheduler_despertar: si la despertaron mientras salía, se encola acá
+        irq_flags = spin_lock_irqsave(&scheduler_cambio_lock);
+        saliente->en_cpu = 0;
+        if (scheduler_encolable(cpu, saliente) == 1)
+        {
+            runqueue_push(&cpu->rq, saliente->task_id);
+        }
+        spin_unlock_irqrestore(&scheduler_cambio_lock, irq_flags);
+        scheduler_avisar_ociosas(id);
+    }
+}
+
+SECCION_TEXT void scheduler_bloquear_actual(void)
+{
+    tcb_tareas.cpus[cpu_id()].actual->estado = TAREA_BLOQUEADA;
+}
+
+SECCION_TEXT void scheduler_despertar(tcb_t *tcb)
+{
+    uint32_t irq_flags;
+    cpu_t *cpu = &tcb_tareas.cpus[cpu_id()];
+
+    irq_flags = spin_lock_irqsave(&scheduler_cambio_lock);
+    if (tcb != NULL && tcb->estado == TAREA_BLOQUEADA)
+    {
+        tcb->estado = TAREA_LISTA;
+        // Si todavía no salió de su CPU la encola scheduler_fin_cambio, o sigue corriendo
+        if (tcb->en_cpu == 0)
+        {
+            // Las de tiempo real no usan la cola: las vuelve a elegir rt_elegir
+            if (rt_es_tiempo_real(tcb->task_id) == 0)
+            {
+                runqueue_push(&cpu->rq, tcb->task_id);
+            }
+#if STRESS_TAREAS > 0
+            tcb->despertada = clock_ciclos();
+#endif
+            if (cpu->actual == cpu->ocioso)
+            {
+                cpu->resched = 1;
+            }
+        }
+    }
+    spin_unlock_irqrestore(&scheduler_cambio_lock, irq_flags);
+}
+
+SECCION_TEXT uint32_t sys_dormir(uint32_t ticks)
+{
+    uint32_t ret = 0;
+    uint32_t irq_flags;
+    tcb_t *actual = scheduler_actual();
+
+    if (ticks > 0 && actual->task_id < CANT_TASKS)
+    {
+        irq_flags = spin_lock_irqsave(&scheduler_dormidas_lock);
+        actual->dormir_hasta = scheduler_ticks + ticks;
+        if (actual->dormir_hasta == 0)
+        {
+            actual->dormir_hasta = 1; // 0 indica que no duerme
+        }
+        scheduler_dormidas++;
+        scheduler_bloquear_actual();
+        spin_unlock_irqrestore(&scheduler_dormidas_lock, irq_flags);
+        ret = 1;
+    }
+    return ret;
+}
+
+SECCION_TEXT void scheduler_dormidas_tick(void)
+{
+    uint32_t i = 0;
+    uint32_t irq_flags;
+    tcb_t *tcb;
+
+    irq_flags = spin_lock_irqsave(&scheduler_dormidas_lock);
+    scheduler_ticks++;
+    for (i = 0; i < CANT_TASKS && scheduler_dormidas > 0; i++)
+    {
+        tcb = &tcb_tareas.tareas[i];
+        // Comparación con signo: sigue funcionando cuando el contador da la vuelta
+        if (tcb->dormir_hasta != 0 && (int32_t)(scheduler_ticks - tcb->dormir_hasta) >= 0)
+        {
+            tcb->dormir_hasta = 0;
+            scheduler_dormidas--;
+            scheduler_despertar(tcb);
+        }
+    }
+    spin_unlock_irqrestore(&scheduler_dormidas_lock, irq_flags);
+}
+
+SECCION_TEXT void save_context(tcb_t *tcb, uint32_t *sp_irq)
 {
-    uint32_t *temp_sp_svc;
     uint32_t *temp_sp_sys;
-    uint32_t *temp_lr_svc;
     uint32_t *temp_lr_sys;
+    // El frame queda donde lo armó el handler, en la pila de kernel de la tarea: no hay nada que copiar
     tcb->sp_irq = sp_irq;
-    __asm__("CPS %0" : : "i"(MODE_SYS));        // Cambio al modo SYS
-    __asm__("MOV %0, SP" : "=r"(temp_sp_sys));  // Guardo el stack pointer en el contexto
-    __asm__("MOV %0, LR" : "=r"(temp_lr_sys));  // Guardo el link register del modo SYS
-    __asm__("CPS %0" : : "i"(MODE_SVC));        // Cambio al modo SVC
-    __asm__("MOV %0, SP" : "=r"(temp_sp_svc));  // Guardo el stack pointer en el contexto
-    __asm__("MOV %0, LR" : "=r"(temp_lr_svc));  // Guardo el link register del modo SVC
-    __asm__("CPS %0" : : "i"(MODE_IRQ));        // Vuelvo al modo IRQ
-    tcb->sp_svc = temp_sp_svc;                   // Guardo el stack pointer de SVC
+    // Una sola sentencia: con optimización el compilador no puede mover las lecturas fuera del cambio de modo
+    __asm__ volatile("CPS %2\n\t"       // Cambio al modo SYS
+                     "MOV %0, SP\n\t"   // Guardo el stack pointer en el contexto
+                     "MOV %1, LR\n\t"   // Guardo el link register del modo SYS
+                     "CPS %3"             // Vuelvo al modo SVC
+                     : "=&r"(temp_sp_sys), "=&r"(temp_lr_sys)
+                     : "i"(MODE_SYS), "i"(MODE_SVC)
+                     : "lr", "memory");
     tcb->sp_sys = temp_sp_sys;                   // Guardo el stack pointer de SYS
-    tcb->lr_svc = temp_lr_svc;       // Guardo el link register de SVC
     tcb->lr_sys = temp_lr_sys;       // Guardo el link register de SYS
 }
 
-__attribute__((section(".text"))) void context_switch(tcb_t *tcb, uint32_t **sp_irq)
+SECCION_TEXT void context_switch(tcb_t *tcb, uint32_t **sp_irq)
 {
-    uint32_t *temp_sp_svc;
     uint32_t *temp_sp_sys;
-    uint32_t *temp_lr_svc;
     uint32_t *temp_lr_sys;
+    // El SP y el LR de SVC salen del frame: el handler los carga al restaurarlo
     *sp_irq = tcb->sp_irq;
-    temp_sp_svc = tcb->sp_svc;
     temp_sp_sys = tcb->sp_sys;
-    temp_lr_svc = tcb->lr_svc;
     temp_lr_sys = tcb->lr_sys;
-    __asm__("CPS %0" : : "i"(MODE_SYS));        // Cambio al modo SYS
-    __asm__("MOV SP, %0" : : "r"(temp_sp_sys)); // Restauro el stack pointer en el contexto
-    __asm__("MOV LR, %0" : : "r"(temp_lr_sys)); // Restauro el link register en el contexto
-    __asm__("CPS %0" : : "i"(MODE_SVC));        // Cambio al modo SVC
-    __asm__("MOV SP, %0" : : "r"(temp_sp_svc)); // Restauro el stack pointer en el contexto
-    __asm__("MOV LR, %0" : : "r"(temp_lr_svc)); // Restauro el link register en el contexto
-    __asm__("CPS %0" : : "i"(MODE_IRQ));        // Vuelvo al modo IRQ
+    scheduler_tls_cargar(tcb);
+#ifdef AISLAMIENTO
+    espacios_activar(tcb);
+#endif
+    __asm__ volatile("CPS %2\n\t"       // Cambio al modo SYS
+                     "MOV SP, %0\n\t"   // Restauro el stack pointer en el contexto
+                     "MOV LR, %1\n\t"   // Restauro el link register en el contexto
+                     "CPS %3"             // Vuelvo al modo SVC
+                     :
+                     : "r"(temp_sp_sys), "r"(temp_lr_sys), "i"(MODE_SYS), "i"(MODE_SVC)
+                     : "lr", "memory");
+}
+
+SECCION_TEXT void scheduler_tls_cargar(tcb_t *tcb)
+{
+    // Registro de solo lectura en modo usuario: la tarea encuentra su arena sin entrar al kernel
+    __asm__ volatile("MCR p15, 0, %0, c13, c0, 3" : : "r"(tcb->tls) : "memory");
+#ifdef NEWLIB
+    _impure_ptr = (tcb->tls != NULL) ? &((heap_arena_t *)tcb->tls)->reent : _global_impure_ptr;
+#endif
 }
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    smp.c
+ * @brief   Implementación del arranque y la coordinación de múltiples CPUs
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+extern tcb_context_t tcb_tareas;
+
+volatile uint32_t smp_entrada = 0;
+__attribute__((section(".tcb_data"))) volatile uint32_t smp_cpus_online = 1;
+
+SECCION_TEXT uint32_t cpu_id(void)
+{
+    uint32_t id = 0;
+#ifdef SMP
+    __asm__ volatile("MRC p15, 0, %0, c0, c0, 5" : "=r"(id)); // MPIDR
+    id &= 0x3U;
+#endif
+    return id;
+}
+
+SECCION_TEXT void smp_boot_secundarios(void)
+{
+#ifdef SMP
+    // Holding pen propio (startup.s) y el del bootloader de QEMU, que lee SYS_FLAGS
+    smp_entrada = (uint32_t)_start_secundario;
+    REALVIEW_SYS_FLAGSCLR = 0xFFFFFFFFU;
+    REALVIEW_SYS_FLAGSSET = (uint32_t)_start_secundario;
+#ifdef CACHE
+    // Las secundarias arrancan sin cache: todo lo que escribió la CPU0 tiene que estar en memoria
+    cache_limpiar_todo();
+#endif
+    __asm__ volatile("DSB\n\t"
+                     "SEV"
+                     :
+                     :
+                     : "memory");
+    mpcore_send_sgi(GIC_SGI_WAKEUP, GICD_SGIR_OTROS, 0);
+#endif
+}
+
+SECCION_TEXT void smp_secundario_init(void)
+{
+    uint32_t irq_flags;
+#ifdef CACHE
+    mmu_habilitar(); // La tabla ya la armó la CPU0
+#endif
+    pmu_init(); // El contador de ciclos es propio de cada CPU
+#if CACHE_BENCH_TICKS > 0
+    cache_bench_init();
+#endif
+    mpcore_cpu_init();
+    IRQ_SAVE(irq_flags);
+    smp_cpus_online++;
+    IRQ_RESTORE(irq_flags);
+}
+
+SECCION_TEXT void smp_send_resched(uint32_t cpu)
+{
+#ifdef SMP
+    if (cpu < CANT_CPUS && cpu != cpu_id())
+    {
+        mpcore_send_sgi(GIC_SGI_RESCHED, GICD_SGIR_TARGET_LIST, 1U << cpu);
+    }
+#endif
+}
+
+SECCION_TEXT uint32_t *RESCHED_IRQHandler(uint32_t *sp_irq)
+{
+    tcb_tareas.cpus[cpu_id()].resched = 1;
+    return resched_handler(sp_irq);
+}
+
+SECCION_TEXT void smp_report(void)
+{
+    uint32_t i = 0;
+    cpu_t *cpu;
+    kprint_str("[smp] cpu  ocupados  ociosos  cambios   robos\n");
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        cpu = &tcb_tareas.cpus[i];
+        kprint_str("[smp] ");
+        kprint_dec_ancho(i, 3);
+        kprint_dec_ancho(cpu->ticks_ocupados, 10);
+        kprint_dec_ancho(cpu->ticks_ociosos, 9);
+        kprint_dec_ancho(cpu->cambios, 9);
+        kprint_dec_ancho(cpu->robos, 8);
+        kprint_str("\n");
+    }
+}
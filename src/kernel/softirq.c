@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    softirq.c
+ * @brief   Softirqs: trabajo diferido que corre a la salida de la IRQ con las interrupciones habilitadas
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+__attribute__((section(".tcb_data"))) softirq_cpu_t softirq_cpus[CANT_CPUS];
+
+extern uint32_t _softirq_stack_top_;
+
+#if IRQOFF_REPORT_TICKS > 0
+__attribute__((section(".tcb_data"))) static uint32_t irqoff_ticks_reporte;
+
+SECCION_TEXT static void irqoff_report_work(void *arg)
+{
+    (void)arg;
+    irqoff_report();
+}
+__attribute__((section(".tcb_data"))) static work_t irqoff_work = WORK_INIT(irqoff_report_work, NULL);
+#endif
+
+SECCION_TEXT static void softirq_timer(void)
+{
+    uint32_t ticks;
+    uint32_t irq_flags;
+    softirq_cpu_t *cpu = &softirq_cpus[cpu_id()];
+
+    // El bit de la softirq es uno solo: los ticks que llegaron mientras estaba pendiente se cuentan aparte
+    IRQ_SAVE(irq_flags);
+    ticks = cpu->ticks;
+    cpu->ticks = 0;
+    IRQ_RESTORE(irq_flags);
+
+    clock_tick(); // Lee el contador de ciclos: una vez alcanza para todos los ticks
+    for (; ticks > 0; ticks--)
+    {
+#if CACHE_BENCH_TICKS > 0
+        cache_bench_tick();
+#endif
+        if (cpu_id() == 0)
+        {
+            scheduler_dormidas_tick();
+            anillos_tick();
+#if STRESS_TAREAS > 0
+            stress_tick();
+#endif
+        }
+#if IRQOFF_REPORT_TICKS > 0
+        if (cpu_id() == 0)
+        {
+            irqoff_ticks_reporte++;
+            if (irqoff_ticks_reporte >= IRQOFF_REPORT_TICKS)
+            {
+                irqoff_ticks_reporte = 0;
+                workqueue_encolar(&irqoff_work);
+            }
+        }
+#endif
+    }
+}
+
+static void (*const softirq_handlers[SOFTIRQ_CANT])(void) = {
+    softirq_timer,
+    uart_rx_softirq,
+    dma_uart_softirq,
+};
+
+SECCION_TEXT void softirq_raise(softirq_t n)
+{
+    uint32_t irq_flags;
+    softirq_cpu_t *cpu = &softirq_cpus[cpu_id()];
+
+    IRQ_SAVE(irq_flags);
+    cpu->pendientes |= 1U << n;
+    IRQ_RESTORE(irq_flags);
+}
+
+SECCION_TEXT void softirq_tick(void)
+{
+    uint32_t irq_flags;
+    softirq_cpu_t *cpu = &softirq_cpus[cpu_id()];
+
+    IRQ_SAVE(irq_flags);
+    cpu->ticks++;
+    cpu->pendientes |= 1U << SOFTIRQ_TIMER;
+    IRQ_RESTORE(irq_flags);
+}
+
+SECCION_TEXT uint32_t softirq_en_curso(void)
+{
+    return softirq_cpus[cpu_id()].en_curso;
+}
+
+SECCION_TEXT uint32_t *softirq_pila(void)
+{
+    uint32_t *top = &_softirq_stack_top_;
+#ifdef SMP
+    uint32_t id = cpu_id();
+
+    // La pila de softirqs es la última del bloque de la CPU: su tope es el final del bloque
+    if (id != 0)
+    {
+        top = (uint32_t *)((uint32_t)&_cpu_stacks_start_ + id * (uint32_t)&_cpu_stack_block_size_);
+    }
+#endif
+    return top;
+}
+
+SECCION_TEXT void softirq_ejecutar(void)
+{
+    uint32_t n = 0;
+    uint32_t vuelta = 0;
+    uint32_t pendientes;
+    uint32_t irq_flags;
+    softirq_cpu_t *cpu = &softirq_cpus[cpu_id()];
+
+    cpu->en_curso = 1;
+    for (vuelta = 0; vuelta < SOFTIRQ_MAX_VUELTAS; vuelta++)
+    {
+        // Tomo y limpio el bitmap de una vez; lo que marquen las IRQ anidadas sale en la vuelta siguiente
+        IRQ_SAVE(irq_flags);
+        pendientes = cpu->pendientes;
+        cpu->pendientes = 0;
+        IRQ_RESTORE(irq_flags);
+        if (pendientes == 0)
+        {
+            break;
+        }
+        for (n = 0; n < SOFTIRQ_CANT; n++)
+        {
+            if ((pendientes & (1U << n)) != 0)
+            {
+                softirq_handlers[n]();
+                cpu->ejecutadas++;
+            }
+        }
+    }
+    cpu->en_curso = 0;
+}
+
+SECCION_TEXT void irqoff_entrada(void)
+{
+    uint32_t ciclos;
+    PMU_READ_CCNT(ciclos);
+    softirq_cpus[cpu_id()].entrada = ciclos;
+}
+
+SECCION_TEXT void irqoff_salida(irqoff_tipo_t tipo)
+{
+    uint32_t ciclos;
+    softirq_cpu_t *cpu = &softirq_cpus[cpu_id()];
+    irqoff_stats_t *st = &cpu->stats[tipo];
+
+    PMU_READ_CCNT(ciclos);
+    ciclos -= cpu->entrada;
+    if (ciclos > st->max)
+    {
+        st->max = ciclos;
+    }
+    st->prom = (uint32_t)((int32_t)st->prom + (((int32_t)ciclos - (int32_t)st->prom) >> 4));
+    st->cant++;
+}
+
+SECCION_TEXT uint32_t irq_salida(void)
+{
+    softirq_cpu_t *cpu = &softirq_cpus[cpu_id()];
+    irqoff_salida(IRQOFF_IRQ);
+    return (cpu->pendientes != 0 && cpu->en_curso == 0) ? 1U : 0U;
+}
+
+SECCION_TEXT void irqoff_report(void)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+    irqoff_stats_t *st;
+    static const char *const nombres[IRQOFF_CANT] = {" irq max/prom: ", " svc max/prom: "};
+
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        kprint_str("[irqoff] cpu ");
+        kprint_dec(i);
+        for (j = 0; j < IRQOFF_CANT; j++)
+        {
+            st = &softirq_cpus[i].stats[j];
+            kprint_str(nombres[j]);
+            kprint_dec(st->max);
+            kprint_str("/");
+            kprint_dec(st->prom);
+        }
+        kprint_str(" ciclos, softirqs: ");
+        kprint_dec(softirq_cpus[i].ejecutadas);
+        kprint_str("\n");
+    }
+}
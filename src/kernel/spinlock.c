@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    spinlock.c
+ * @brief   Implementación de spinlocks basados en LDREX/STREX con WFE/SEV
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+SECCION_TEXT void spin_lock(spinlock_t *sl)
+{
+    uint32_t tmp;
+    __asm__ volatile("1: LDREX %0, [%1]\n\t"   // Leo el lock marcando acceso exclusivo
+                     "   TEQ %0, #0\n\t"
+                     "   WFENE\n\t"             // Ocupado: espero el SEV del que lo libere
+                     "   BNE 1b\n\t"
+                     "   STREX %0, %2, [%1]\n\t" // Intento tomarlo
+                     "   TEQ %0, #0\n\t"
+                     "   BNE 1b\n\t"            // Perdí la exclusividad: reintento
+                     "   DMB"
+                     : "=&r"(tmp)
+                     : "r"(&sl->lock), "r"(1U)
+                     : "cc", "memory");
+}
+
+SECCION_TEXT void spin_unlock(spinlock_t *sl)
+{
+    __asm__ volatile("DMB" : : : "memory");
+    sl->lock = 0;
+    __asm__ volatile("DSB\n\t"
+                     "SEV"
+                     :
+                     :
+                     : "memory");
+}
+
+SECCION_TEXT uint32_t spin_lock_irqsave(spinlock_t *sl)
+{
+    uint32_t flags;
+    IRQ_SAVE(flags);
+    spin_lock(sl);
+    return flags;
+}
+
+SECCION_TEXT void spin_unlock_irqrestore(spinlock_t *sl, uint32_t flags)
+{
+    spin_unlock(sl);
+    IRQ_RESTORE(flags);
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    stack_monitor.c
+ * @brief   Implementación del pintado y monitoreo de las pilas de las tareas
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+__attribute__((section(".tcb_data"))) stack_info_t stack_info[CANT_TASKS][STACK_CANT_MODOS];
+__attribute__((section(".tcb_data"))) uint32_t stack_scan_actual = 0;
+
+static const char *const stack_nombres_modo[STACK_CANT_MODOS] = {"krn", "sys"};
+
+SECCION_TEXT static void stack_set(uint32_t task_id, uint32_t *start, uint32_t *kernel_top, uint32_t *sys_top)
+{
+    stack_info[task_id][STACK_KERNEL].base = start;
+    stack_info[task_id][STACK_KERNEL].top = kernel_top;
+    // Con AISLAMIENTO la pila SYS arranca en una página propia, separada de la de kernel
+    stack_info[task_id][STACK_SYS].base = sys_top - STACK_TAREA_PALABRAS;
+    stack_info[task_id][STACK_SYS].top = sys_top;
+}
+
+SECCION_TEXT void stack_monitor_init(void)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+    uint32_t *ptr;
+    stack_info_t *info;
+
+    stack_set(TASK_IDLE, &_tareaidle_stack_start_, &_tareaidle_svc_stack_top_, &_tareaidle_sys_stack_top_);
+    stack_set(TASK_1, &_tarea1_stack_start_, &_tarea1_svc_stack_top_, &_tarea1_sys_stack_top_);
+    stack_set(TASK_2, &_tarea2_stack_start_, &_tarea2_svc_stack_top_, &_tarea2_sys_stack_top_);
+    stack_set(TASK_3, &_tarea3_stack_start_, &_tarea3_svc_stack_top_, &_tarea3_sys_stack_top_);
+    stack_set(TASK_WORKER, &_tareaworker_stack_start_, &_tareaworker_svc_stack_top_, &_tareaworker_sys_stack_top_);
+#if STRESS_TAREAS > 0
+    for (i = 0; i < STRESS_TAREAS; i++)
+    {
+        stack_set(TASK_STRESS_BASE + i, stress_pila(i, STACK_KERNEL), stress_pila(i, STACK_KERNEL) + STRESS_KPILA_PALABRAS,
+                  stress_pila(i, STACK_SYS) + STRESS_PILA_PALABRAS);
+    }
+#endif
+
+    for (i = 0; i < CANT_TASKS; i++)
+    {
+        for (j = 0; j < STACK_CANT_MODOS; j++)
+        {
+            info = &stack_info[i][j];
+            info->base[0] = STACK_CANARY;
+            for (ptr = info->base + 1; ptr < info->top; ptr++)
+            {
+                *ptr = STACK_PAINT;
+            }
+            info->marca = info->top;
+            info->cursor = info->base + 1;
+        }
+    }
+    stack_scan_actual = 0;
+}
+
+SECCION_TEXT void stack_scan_step(void)
+{
+    uint32_t n = 0;
+    stack_info_t *info = &stack_info[0][0] + stack_scan_actual;
+    uint8_t terminado = 0;
+
+    // Las pilas full descending crecen hacia abajo: la primera palabra sin el patrón
+    // desde la base es la más profunda que se usó. La marca solo puede bajar.
+    while (n < STACK_SCAN_WORDS && terminado == 0)
+    {
+        if (info->cursor >= info->marca)
+        {
+            terminado = 1;
+        }
+        else if (*info->cursor != STACK_PAINT)
+        {
+            info->marca = info->cursor;
+            terminado = 1;
+        }
+        else
+        {
+            info->cursor++;
+            n++;
+        }
+    }
+
+    if (terminado == 1)
+    {
+        // Vuelvo a empezar esta pila en la próxima vuelta y paso a la siguiente
+        info->cursor = info->base + 1;
+        stack_scan_actual++;
+        if (stack_scan_actual >= CANT_TASKS * STACK_CANT_MODOS)
+        {
+            stack_scan_actual = 0;
+        }
+    }
+}
+
+SECCION_TEXT void stack_check_canary(uint32_t task_id)
+{
+    uint32_t j = 0;
+    if (task_id < CANT_TASKS)
+    {
+        for (j = 0; j < STACK_CANT_MODOS; j++)
+        {
+            if (stack_info[task_id][j].base[0] != STACK_CANARY)
+            {
+                kprint_str("\n[stack] desborde de la pila ");
+                kprint_str(stack_nombres_modo[j]);
+                kprint_str(" de la tarea ");
+                kprint_dec(task_id);
+                kprint_str("\n");
+                stack_report();
+#ifdef DMA_UART
+                dma_uart_vaciar();
+#endif
+                halt_cpu();
+            }
+        }
+    }
+}
+
+SECCION_TEXT int stack_max_usado(uint32_t task_id, uint32_t modo)
+{
+    int ret = -1;
+    stack_info_t *info;
+    if (task_id < CANT_TASKS && modo < STACK_CANT_MODOS)
+    {
+        info = &stack_info[task_id][modo];
+        ret = (int)((uint32_t)info->top - (uint32_t)info->marca);
+    }
+    return ret;
+}
+
+SECCION_TEXT void stack_report(void)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+    stack_info_t *info;
+
+    kprint_str("[stack] tarea modo   usado  tamanio\n");
+    for (i = 0; i < CANT_TASKS; i++)
+    {
+        for (j = 0; j < STACK_CANT_MODOS; j++)
+        {
+            info = &stack_info[i][j];
+            kprint_str("[stack] ");
+            kprint_dec_ancho(i, 5);
+            kprint_str(" ");
+            kprint_str(stack_nombres_modo[j]);
+            kprint_dec_ancho((uint32_t)stack_max_usado(i, j), 8);
+            kprint_dec_ancho((uint32_t)info->top - (uint32_t)info->base, 9);
+            kprint_str("\n");
+        }
+    }
+}
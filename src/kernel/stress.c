@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    stress.c
+ * @brief   Generador de carga sintética: creación de las tareas y métricas de escalabilidad
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+extern tcb_context_t tcb_tareas;
+
+#if STRESS_TAREAS > 0
+
+// Hasta 256 tareas x 2 pilas no entran en public_stack: el linker las ubica a continuación del heap
+// del kernel, con el tamaño de pila que define. Las SYS van aparte porque con AISLAMIENTO las escribe
+// el modo usuario.
+extern uint32_t _stress_stacks_start_;
+extern uint32_t _stress_stacks_sys_start_;
+
+__attribute__((section(".tcb_data"))) stress_t stress;
+
+SECCION_TEXT static void stress_report_work(void *arg)
+{
+    (void)arg;
+    stress_report();
+}
+__attribute__((section(".tcb_data"))) static work_t stress_work = WORK_INIT(stress_report_work, NULL);
+
+SECCION_TEXT uint32_t *stress_pila(uint32_t n, uint32_t modo)
+{
+    return (modo == STACK_SYS) ? &_stress_stacks_sys_start_ + n * STRESS_PILA_PALABRAS
+                               : &_stress_stacks_start_ + n * STRESS_KPILA_PALABRAS;
+}
+
+SECCION_TEXT void stress_init(void)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+    stress_cpu_t *c;
+
+    for (i = 0; i < STRESS_TAREAS; i++)
+    {
+        scheduler_tcb_init(&tcb_tareas.tareas[TASK_STRESS_BASE + i], (task_id_t)(TASK_STRESS_BASE + i),
+                           STRESS_QUANTUM, tarea_stress, stress_pila(i, STACK_KERNEL) + STRESS_KPILA_PALABRAS,
+                           stress_pila(i, STACK_SYS) + STRESS_PILA_PALABRAS);
+        stress_items[i] = 0;
+    }
+
+    stress.estado = STRESS_ESPERANDO;
+    stress.ticks = 0;
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        c = &stress.cpus[i];
+        c->ciclos_sched = 0;
+        c->ciclos_total = 0;
+        c->ccnt_tick = 0;
+        c->ccnt_sched = 0;
+        c->syscalls = 0;
+        c->lat_max = 0;
+        for (j = 0; j < STRESS_LAT_CANT; j++)
+        {
+            c->lat_hist[j] = 0;
+        }
+    }
+}
+
+SECCION_TEXT void stress_ciclos_tick(void)
+{
+    uint32_t ciclos;
+    stress_cpu_t *c = &stress.cpus[cpu_id()];
+
+    PMU_READ_CCNT(ciclos);
+    if (stress.estado == STRESS_MIDIENDO)
+    {
+        c->ciclos_total += ciclos - c->ccnt_tick;
+    }
+    c->ccnt_tick = ciclos;
+}
+
+SECCION_TEXT void stress_sched_entrada(void)
+{
+    uint32_t ciclos;
+    PMU_READ_CCNT(ciclos);
+    stress.cpus[cpu_id()].ccnt_sched = ciclos;
+}
+
+SECCION_TEXT void stress_sched_salida(void)
+{
+    uint32_t ciclos;
+    stress_cpu_t *c = &stress.cpus[cpu_id()];
+
+    PMU_READ_CCNT(ciclos);
+    if (stress.estado == STRESS_MIDIENDO)
+    {
+        c->ciclos_sched += ciclos - c->ccnt_sched;
+    }
+}
+
+SECCION_TEXT void stress_syscall(void)
+{
+    stress.cpus[cpu_id()].syscalls++;
+}
+
+SECCION_TEXT void stress_latencia(tcb_t *tcb)
+{
+    uint32_t lat = clock_ciclos() - tcb->despertada;
+    uint32_t barra = 0;
+    stress_cpu_t *c = &stress.cpus[cpu_id()];
+
+    tcb->despertada = 0;
+    if (stress.estado == STRESS_MIDIENDO)
+    {
+        // Barra n: latencias de 2^(n-1) a 2^n - 1 us; la 0 es menos de 1 us
+        barra = (lat == 0) ? 0 : 32U - (uint32_t)__builtin_clz(lat);
+        if (barra >= STRESS_LAT_CANT)
+        {
+            barra = STRESS_LAT_CANT - 1U;
+        }
+        c->lat_hist[barra]++;
+        if (lat > c->lat_max)
+        {
+            c->lat_max = lat;
+        }
+    }
+}
+
+SECCION_TEXT static uint32_t stress_sumar_items(void)
+{
+    uint32_t i = 0;
+    uint32_t suma = 0;
+    for (i = 0; i < STRESS_TAREAS; i++)
+    {
+        suma += stress_items[i];
+    }
+    return suma;
+}
+
+SECCION_TEXT static uint32_t stress_sumar_cambios(void)
+{
+    uint32_t i = 0;
+    uint32_t suma = 0;
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        suma += tcb_tareas.cpus[i].cambios;
+    }
+    return suma;
+}
+
+SECCION_TEXT static uint32_t stress_sumar_syscalls(void)
+{
+    uint32_t i = 0;
+    uint32_t suma = 0;
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        suma += stress.cpus[i].syscalls;
+    }
+    return suma;
+}
+
+SECCION_TEXT void stress_tick(void)
+{
+    if (stress.estado == STRESS_ESPERANDO)
+    {
+        stress.inicio_us = clock_ciclos();
+        stress.items = stress_sumar_items();
+        stress.cambios = stress_sumar_cambios();
+        stress.syscalls = stress_sumar_syscalls();
+        stress.estado = STRESS_MIDIENDO;
+    }
+    else if (stress.estado == STRESS_MIDIENDO)
+    {
+        stress.ticks++;
+        if (stress.ticks >= STRESS_DURACION_TICKS)
+        {
+            stress.estado = STRESS_TERMINADO;
+            stress.fin_us = clock_ciclos();
+            stress.items = stress_sumar_items() - stress.items;
+            stress.cambios = stress_sumar_cambios() - stress.cambios;
+            stress.syscalls = stress_sumar_syscalls() - stress.syscalls;
+            workqueue_encolar(&stress_work);
+        }
+    }
+}
+
+SECCION_TEXT static uint32_t stress_por_segundo(uint32_t cant, uint32_t ms)
+{
+    uint32_t ret = 0;
+    if (ms > 0)
+    {
+        // Sin división de 64 bits: con muchos eventos se divide primero y se pierde la fracción
+        ret = (cant < 4000000U) ? kdiv(cant * 1000U, ms) : kdiv(cant, ms) * 1000U;
+    }
+    return ret;
+}
+
+SECCION_TEXT static void stress_imprimir_tasa(const char *nombre, uint32_t cant, uint32_t ms)
+{
+    kprint_str("[stress] ");
+    kprint_str(nombre);
+    kprint_dec(cant);
+    kprint_str(" (");
+    kprint_dec(stress_por_segundo(cant, ms));
+    kprint_str("/s)\n");
+}
+
+SECCION_TEXT static void stress_imprimir_centesimos(uint32_t valor)
+{
+    uint32_t enteros = kdiv(valor, 100U);
+    uint32_t resto = valor - enteros * 100U;
+    kprint_dec(enteros);
+    kprint_str(resto < 10U ? ".0" : ".");
+    kprint_dec(resto);
+}
+
+SECCION_TEXT static uint32_t stress_percentil(const uint32_t *hist, uint32_t total, uint32_t objetivo)
+{
+    uint32_t i = 0;
+    uint32_t acum = 0;
+    uint32_t ret = STRESS_LAT_CANT - 1U;
+
+    for (i = 0; i < STRESS_LAT_CANT && total > 0; i++)
+    {
+        acum += hist[i];
+        if (acum >= objetivo)
+        {
+            ret = i;
+            break;
+        }
+    }
+    // Cota superior de la barra, en us
+    return (ret == 0) ? 0 : (1U << ret) - 1U;
+}
+
+SECCION_TEXT void stress_report(void)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+    uint32_t ms = kdiv(stress.fin_us - stress.inicio_us, 1000U);
+    uint32_t hist[STRESS_LAT_CANT];
+    uint32_t total = 0;
+    uint32_t max = 0;
+    uint32_t min_items = 0xFFFFFFFFU;
+    uint32_t max_items = 0;
+    uint64_t sched;
+    uint64_t ciclos;
+    stress_cpu_t *c;
+
+    kprint_str("[stress] tareas: ");
+    kprint_dec(STRESS_TAREAS);
+    kprint_str(" cpus: ");
+    kprint_dec(CANT_CPUS);
+    kprint_str(" duracion: ");
+    kprint_dec(ms);
+    kprint_str(" ms\n");
+    stress_imprimir_tasa("items de trabajo: ", stress.items, ms);
+    stress_imprimir_tasa("cambios de contexto: ", stress.cambios, ms);
+    stress_imprimir_tasa("llamadas al sistema: ", stress.syscalls, ms);
+
+    for (i = 0; i < STRESS_TAREAS; i++)
+    {
+        if (stress_items[i] < min_items)
+        {
+            min_items = stress_items[i];
+        }
+        if (stress_items[i] > max_items)
+        {
+            max_items = stress_items[i];
+        }
+    }
+    kprint_str("[stress] items por tarea min/max: ");
+    kprint_dec(min_items);
+    kprint_str("/");
+    kprint_dec(max_items);
+    kprint_str("\n");
+
+    for (j = 0; j < STRESS_LAT_CANT; j++)
+    {
+        hist[j] = 0;
+    }
+    for (i = 0; i < CANT_CPUS; i++)
+    {
+        c = &stress.cpus[i];
+        // Se achican los dos contadores hasta que el cociente en centésimos de % entre en 32 bits
+        sched = c->ciclos_sched;
+        ciclos = c->ciclos_total;
+        while ((ciclos >> 18) != 0)
+        {
+            sched >>= 1;
+            ciclos >>= 1;
+        }
+        kprint_str("[stress] cpu ");
+        kprint_dec(i);
+        kprint_str(" scheduler: ");
+        stress_imprimir_centesimos((ciclos > 0) ? kdiv((uint32_t)sched * 10000U, (uint32_t)ciclos) : 0);
+        kprint_str(" % de los ciclos\n");
+
+        for (j = 0; j < STRESS_LAT_CANT; j++)
+        {
+            hist[j] += c->lat_hist[j];
+            total += c->lat_hist[j];
+        }
+        if (c->lat_max > max)
+        {
+            max = c->lat_max;
+        }
+    }
+
+    kprint_str("[stress] latencia despertar->despacho (us): muestras ");
+    kprint_dec(total);
+    kprint_str(" p50 <= ");
+    kprint_dec(stress_percentil(hist, total, total - (total >> 1)));
+    kprint_str(" p99 <= ");
+    kprint_dec(stress_percentil(hist, total, total - kdiv(total, 100U)));
+    kprint_str(" max ");
+    kprint_dec(max);
+    kprint_str("\n");
+#ifdef CONSOLA
+    consola_report();
+#endif
+    kmem_report();
+}
+
+#endif // STRESS_TAREAS > 0
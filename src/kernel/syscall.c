@@ -29,8 +29,24 @@
 #include "defines.h"
 #include "board/uart.h"
 
-__attribute__((section(".text"))) int sys_my_printf(const char *buf)
+SECCION_TEXT int sys_my_printf(const char *buf)
 {
+#if defined(CONSOLA)
+    // El kernel escribe por el canal 0, encolado junto con las tareas asignadas a la UART0
+    uint32_t len = 0;
+    if (buf == NULL)
+    {
+        return -1;
+    }
+    while (buf[len] != '\0')
+    {
+        len++;
+    }
+    return consola_escribir(0, buf, len);
+#elif defined(DMA_UART)
+    // La CPU solo copia al buffer de salida; el PL080 alimenta el FIFO de la UART
+    return dma_uart_escribir(buf);
+#else
     int i = -1; // Valor de retorno por defecto en caso de error
     _uart_t *UART0 = (_uart_t *)UART0_ADDR;
     if (buf != NULL)
@@ -43,20 +59,177 @@ __attribute__((section(".text"))) int sys_my_printf(const char *buf)
         }
     }
     return i;
+#endif
 }
 
-__attribute__((section(".text"))) uint32_t *C_SVC_handler(uint32_t svc_num, uint32_t *sp_irq)
+SECCION_TEXT int sys_my_printf_len(const char *buf, uint32_t len)
+{
+#if defined(CONSOLA)
+    return consola_escribir(0, buf, len);
+#elif defined(DMA_UART)
+    return dma_uart_escribir_len(buf, len);
+#else
+    uint32_t i = 0;
+    _uart_t *UART0 = (_uart_t *)UART0_ADDR;
+    if (buf == NULL)
+    {
+        return -1;
+    }
+    while (i < len)
+    {
+        uart_putc(UART0, (unsigned int)(buf[i]));
+        i++;
+    }
+    return (int)i;
+#endif
+}
+
+SECCION_TEXT uint32_t *C_SVC_handler(uint32_t svc_num, uint32_t *sp_irq)
 {
     // Extraemos los argumentos de la syscall desde los registros
     uint32_t arg0; // r0
+    uint32_t arg1; // r1
+    uint32_t arg2; // r2
+    uint32_t *ret = sp_irq; // Frame a restaurar, cambia si la llamada replanificó
+    uint32_t bloqueada = 0;
+    int32_t largo; // De las cadenas de usuario, -1 si no son accesibles
 
+    irqoff_entrada();
+#if STRESS_TAREAS > 0
+    stress_syscall();
+#endif
     if (sp_irq != NULL)
     {
         arg0 = sp_irq[2]; // r0
+        arg1 = sp_irq[3]; // r1
+        arg2 = sp_irq[4]; // r2
         switch (svc_num)
         {
+        case SYS_READ:
+            sp_irq[2] = (uint32_t)-1;
+            if (espacios_usuario_valido(scheduler_actual(), (const void *)arg1, arg2, 1U) == 1)
+            {
+                sp_irq[2] = sys_read(arg0, (uint8_t *)arg1, arg2);
+            }
+            if ((int)sp_irq[2] == UART_RX_REINTENTAR)
+            {
+                // Bloqueada: el frame vuelve a apuntar al SVC con los argumentos originales,
+                // así al despertarse la tarea repite la lectura sin enterarse
+                sp_irq[2] = arg0;
+                sp_irq[15] -= ((sp_irq[1] & SVC_PSR_T) != 0U) ? 2U : 4U;
+                ret = scheduler_yield(sp_irq);
+            }
+            break;
+#ifdef CONSOLA
+        case SYS_WRITE:
+            // Cada tarea escribe en su propio canal: las ruidosas no demoran a las demás
+            largo = espacios_usuario_cadena(scheduler_actual(), (const char *)arg0);
+            sp_irq[2] = (uint32_t)-1;
+            if (largo >= 0)
+            {
+                SVC_IRQ_HABILITAR();
+                sp_irq[2] = sys_consola_escribir((const char *)arg0, (uint32_t)largo);
+                SVC_IRQ_DESHABILITAR();
+            }
+            break;
+        case SYS_WRITE_LEN:
+            sp_irq[2] = (uint32_t)-1;
+            if (espacios_usuario_valido(scheduler_actual(), (const void *)arg0, arg1, 0U) == 1)
+            {
+                SVC_IRQ_HABILITAR();
+                sp_irq[2] = sys_consola_escribir((const char *)arg0, arg1);
+                SVC_IRQ_DESHABILITAR();
+            }
+            break;
+        case SYS_CONSOLE_BIND:
+            sp_irq[2] = sys_consola_asignar(arg0);
+            break;
+#else
         case SYS_WRITE:
-            sp_irq[2] = sys_my_printf((const char *)arg0);
+            largo = espacios_usuario_cadena(scheduler_actual(), (const char *)arg0);
+            sp_irq[2] = (uint32_t)-1;
+            if (largo >= 0)
+            {
+                SVC_IRQ_HABILITAR();
+                sp_irq[2] = sys_my_printf_len((const char *)arg0, (uint32_t)largo);
+                SVC_IRQ_DESHABILITAR();
+            }
+            break;
+        case SYS_WRITE_LEN:
+            sp_irq[2] = (uint32_t)-1;
+            if (espacios_usuario_valido(scheduler_actual(), (const void *)arg0, arg1, 0U) == 1)
+            {
+                SVC_IRQ_HABILITAR();
+                sp_irq[2] = sys_my_printf_len((const char *)arg0, arg1);
+                SVC_IRQ_DESHABILITAR();
+            }
+            break;
+        case SYS_CONSOLE_BIND:
+            sp_irq[2] = (uint32_t)-1; // Sin CONSOLA hay un solo canal
+            break;
+#endif
+        case SYS_EXIT:
+            // Queda bloqueada para siempre: nadie la despierta
+            scheduler_bloquear_actual();
+            ret = scheduler_yield(sp_irq);
+            break;
+        case SYS_GETPID:
+            sp_irq[2] = scheduler_actual()->task_id;
+            break;
+        case SYS_LOG:
+#ifdef BITACORA
+            SVC_IRQ_HABILITAR();
+            sp_irq[2] = sys_bitacora((const uint32_t *)arg0, arg1);
+            SVC_IRQ_DESHABILITAR();
+#else
+            sp_irq[2] = (uint32_t)-1;
+#endif
+            break;
+        case SYS_CLOCK_GETTIME:
+            sp_irq[2] = (uint32_t)-1;
+            if (espacios_usuario_valido(scheduler_actual(), (const void *)arg1, sizeof(timespec_t), 1U) == 1)
+            {
+                sp_irq[2] = sys_clock_gettime(arg0, (timespec_t *)arg1);
+            }
+            break;
+        case SYS_STACK_USAGE:
+            sp_irq[2] = stack_max_usado(arg0, arg1);
+            break;
+        case SYS_RT_WAIT:
+            sp_irq[2] = 0;
+            if (sys_rt_esperar(scheduler_actual()->task_id) == 1)
+            {
+                // Deja la CPU ya: vuelve de la llamada recién en su próxima activación
+                ret = scheduler_yield(sp_irq);
+            }
+            break;
+        case SYS_WORK_WAIT:
+            sp_irq[2] = 0;
+            if (sys_work_esperar() == 1)
+            {
+                ret = scheduler_yield(sp_irq);
+            }
+            break;
+        case SYS_SLEEP_TICKS:
+            sp_irq[2] = 0;
+            if (sys_dormir(arg0) == 1)
+            {
+                ret = scheduler_yield(sp_irq);
+            }
+            break;
+        case SYS_RING_SETUP:
+            sp_irq[2] = sys_anillo_registrar((anillo_t *)arg0, arg1);
+            break;
+        case SYS_RING_ENTER:
+            sp_irq[2] = sys_anillo_enter(arg0, &bloqueada);
+            if (bloqueada == 1)
+            {
+                ret = scheduler_yield(sp_irq);
+            }
+            break;
+        case SYS_SCHED_YIELD:
+            sp_irq[2] = 0;
+            ret = scheduler_yield(sp_irq);
             break;
         default:
             NOP;
@@ -64,5 +237,6 @@ __attribute__((section(".text"))) uint32_t *C_SVC_handler(uint32_t svc_num, uint
         }
     }
 
-    return sp_irq;
+    irqoff_salida(IRQOFF_SVC);
+    return ret;
 }
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    uart_rx.c
+ * @brief   Recepción por interrupción de la UART0 con buffer circular y read bloqueante
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+extern tcb_context_t tcb_tareas;
+
+__attribute__((section(".tcb_data"))) static uint8_t uart_rx_buf[UART_RX_BUF];
+__attribute__((section(".tcb_data"))) static volatile uint32_t uart_rx_inicio;
+__attribute__((section(".tcb_data"))) static volatile uint32_t uart_rx_fin;
+__attribute__((section(".tcb_data"))) static uint32_t uart_rx_esperando[UART_RX_ESPERANDO_PALABRAS]; // Bitmap de tareas bloqueadas en read
+__attribute__((section(".tcb_data"))) static spinlock_t uart_rx_lock = SPINLOCK_INIT;
+__attribute__((section(".tcb_data"))) uart_rx_stats_t uart_rx_stats;
+
+SECCION_TEXT void uart_rx_init(void)
+{
+    uint32_t i = 0;
+
+    uart_rx_inicio = 0;
+    uart_rx_fin = 0;
+    for (i = 0; i < UART_RX_ESPERANDO_PALABRAS; i++)
+    {
+        uart_rx_esperando[i] = 0;
+    }
+
+    PL011_REG(UART0_ADDR, PL011_IFLS) = (PL011_REG(UART0_ADDR, PL011_IFLS) & ~(7U << 3)) | PL011_IFLS_RX_MITAD;
+    PL011_REG(UART0_ADDR, PL011_ICR) = PL011_INT_RX | PL011_INT_RT | PL011_INT_OE;
+    PL011_REG(UART0_ADDR, PL011_IMSC) |= PL011_INT_RX | PL011_INT_RT | PL011_INT_OE;
+
+    gic_habilitar_fuente(GIC_SOURCE_UART0);
+}
+
+SECCION_TEXT void UART0_IRQHandler(void)
+{
+    uint32_t sig;
+
+    spin_lock(&uart_rx_lock);
+    uart_rx_stats.interrupciones++;
+    if ((PL011_REG(UART0_ADDR, PL011_MIS) & PL011_INT_OE) != 0)
+    {
+        uart_rx_stats.overruns++;
+    }
+
+    // Una interrupción por umbral o timeout vacía todo el FIFO de una vez
+    while ((PL011_REG(UART0_ADDR, PL011_FR) & PL011_FR_RXFE) == 0)
+    {
+        sig = (uart_rx_fin + 1U) & (UART_RX_BUF - 1U);
+        if (sig == uart_rx_inicio)
+        {
+            (void)PL011_REG(UART0_ADDR, PL011_DR);
+            uart_rx_stats.descartados++;
+        }
+        else
+        {
+            uart_rx_buf[uart_rx_fin] = (uint8_t)PL011_REG(UART0_ADDR, PL011_DR);
+            uart_rx_fin = sig;
+            uart_rx_stats.recibidos++;
+        }
+    }
+    PL011_REG(UART0_ADDR, PL011_ICR) = PL011_INT_RX | PL011_INT_RT | PL011_INT_OE;
+    spin_unlock(&uart_rx_lock);
+
+    // Despertar a los lectores queda para la mitad inferior
+    softirq_raise(SOFTIRQ_UART_RX);
+}
+
+SECCION_TEXT void uart_rx_softirq(void)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+    uint32_t esperando;
+    uint32_t irq_flags;
+
+    for (i = 0; i < UART_RX_ESPERANDO_PALABRAS; i++)
+    {
+        irq_flags = spin_lock_irqsave(&uart_rx_lock);
+        esperando = uart_rx_esperando[i];
+        uart_rx_esperando[i] = 0;
+        spin_unlock_irqrestore(&uart_rx_lock, irq_flags);
+
+        for (j = 0; j < 32U && esperando != 0; j++)
+        {
+            if ((esperando & (1U << j)) != 0)
+            {
+                esperando &= ~(1U << j);
+                scheduler_despertar(&tcb_tareas.tareas[i * 32U + j]);
+            }
+        }
+    }
+}
+
+SECCION_TEXT int sys_read(uint32_t fd, uint8_t *buf, uint32_t len)
+{
+    int ret = -1;
+    uint32_t irq_flags;
+    tcb_t *actual;
+
+    if (fd == STDIN_FILENO && buf != NULL && len > 0)
+    {
+        ret = 0;
+        irq_flags = spin_lock_irqsave(&uart_rx_lock);
+        while ((uint32_t)ret < len && uart_rx_inicio != uart_rx_fin)
+        {
+            buf[ret] = uart_rx_buf[uart_rx_inicio];
+            uart_rx_inicio = (uart_rx_inicio + 1U) & (UART_RX_BUF - 1U);
+            ret++;
+        }
+        if (ret == 0)
+        {
+            // Sin datos: la tarea duerme hasta la próxima interrupción de recepción
+            actual = scheduler_actual();
+            if (actual->task_id < CANT_TASKS)
+            {
+                uart_rx_esperando[actual->task_id >> 5] |= 1U << (actual->task_id & 31U);
+                scheduler_bloquear_actual();
+                ret = UART_RX_REINTENTAR;
+            }
+        }
+        spin_unlock_irqrestore(&uart_rx_lock, irq_flags);
+    }
+    return ret;
+}
+
+SECCION_TEXT void uart_rx_report(void)
+{
+    kprint_str("[uart_rx] recibidos: ");
+    kprint_dec(uart_rx_stats.recibidos);
+    kprint_str(" descartados: ");
+    kprint_dec(uart_rx_stats.descartados);
+    kprint_str(" overruns: ");
+    kprint_dec(uart_rx_stats.overruns);
+    kprint_str(" interrupciones: ");
+    kprint_dec(uart_rx_stats.interrupciones);
+    kprint_str("\n");
+}
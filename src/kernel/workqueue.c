@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    workqueue.c
+ * @brief   Cola de trabajo diferido atendida por una tarea del kernel
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+extern tcb_context_t tcb_tareas;
+
+__attribute__((section(".tcb_data"))) static work_t *workqueue_inicio;
+__attribute__((section(".tcb_data"))) static work_t *workqueue_fin;
+__attribute__((section(".tcb_data"))) static uint8_t workqueue_esperando;
+__attribute__((section(".tcb_data"))) static spinlock_t workqueue_lock = SPINLOCK_INIT;
+
+SECCION_TEXT uint32_t workqueue_encolar(work_t *w)
+{
+    uint32_t ret = 0;
+    uint32_t irq_flags;
+    uint8_t despertar = 0;
+
+    irq_flags = spin_lock_irqsave(&workqueue_lock);
+    if (w->pendiente == 0)
+    {
+        w->pendiente = 1;
+        w->sig = NULL;
+        if (workqueue_fin == NULL)
+        {
+            workqueue_inicio = w;
+        }
+        else
+        {
+            workqueue_fin->sig = w;
+        }
+        workqueue_fin = w;
+        despertar = workqueue_esperando;
+        workqueue_esperando = 0;
+        ret = 1;
+    }
+    spin_unlock_irqrestore(&workqueue_lock, irq_flags);
+
+    if (despertar == 1)
+    {
+        scheduler_despertar(&tcb_tareas.tareas[TASK_WORKER]);
+    }
+    return ret;
+}
+
+SECCION_TEXT static work_t *workqueue_sacar(void)
+{
+    work_t *w;
+    uint32_t irq_flags = spin_lock_irqsave(&workqueue_lock);
+
+    w = workqueue_inicio;
+    if (w != NULL)
+    {
+        workqueue_inicio = w->sig;
+        if (workqueue_inicio == NULL)
+        {
+            workqueue_fin = NULL;
+        }
+        w->pendiente = 0; // Desde acá se puede volver a encolar mientras corre
+    }
+    spin_unlock_irqrestore(&workqueue_lock, irq_flags);
+    return w;
+}
+
+SECCION_TEXT uint32_t sys_work_esperar(void)
+{
+    uint32_t ret = 0;
+    uint32_t irq_flags = spin_lock_irqsave(&workqueue_lock);
+
+    if (workqueue_inicio == NULL)
+    {
+        workqueue_esperando = 1;
+        scheduler_bloquear_actual();
+        ret = 1;
+    }
+    spin_unlock_irqrestore(&workqueue_lock, irq_flags);
+    return ret;
+}
+
+SECCION_TEXT void tarea_worker(void)
+{
+    work_t *w;
+    while (1)
+    {
+        w = workqueue_sacar();
+        if (w != NULL)
+        {
+            w->funcion(w->arg);
+        }
+        else
+        {
+            // Duerme dentro de la llamada hasta que workqueue_encolar la despierte
+            __asm__ volatile(SVC_INSTR("%0") : : "i"(SYS_WORK_WAIT) : "r0", "r12", "memory");
+        }
+    }
+}
@@ -32,7 +32,7 @@
 #include "utils/console_utils.h"
 #include <stddef.h>
 
-__attribute__((section(".text"))) unsigned int fibonacci(unsigned int n)
+SECCION_TEXT unsigned int fibonacci(unsigned int n)
 {
     unsigned int ret;
     if (n == 0)
@@ -50,7 +50,7 @@ __attribute__((section(".text"))) unsigned int fibonacci(unsigned int n)
     return ret;
 }
 
-__attribute__((section(".text"))) unsigned int conjetura_collatz(unsigned int n)
+SECCION_TEXT unsigned int conjetura_collatz(unsigned int n)
 {
     unsigned int ret;
     if (n % 2 == 0)
@@ -64,7 +64,7 @@ __attribute__((section(".text"))) unsigned int conjetura_collatz(unsigned int n)
     return ret;
 }
 
-__attribute__((section(".text"))) void factorizacion_primos(unsigned int n, unsigned int *factores)
+SECCION_TEXT void factorizacion_primos(unsigned int n, unsigned int *factores)
 {
     unsigned int i = 0, j = 0;
     if (factores != NULL)
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    stress_tareas.c
+ * @brief   Tareas del generador de carga sintética
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+#include "tasks/funciones.h"
+
+#if STRESS_TAREAS > 0
+
+// Items de trabajo completados por cada tarea; solo los escribe la dueña, desde el modo usuario
+__attribute__((section(".usuario_data"))) volatile uint32_t stress_items[STRESS_TAREAS];
+
+__attribute__((section(".tareastress_text"))) static uint32_t stress_aleatorio(uint32_t *semilla)
+{
+    // LFSR de Galois de 32 bits
+    uint32_t lsb = *semilla & 1U;
+    *semilla >>= 1;
+    if (lsb != 0)
+    {
+        *semilla ^= 0x80200003U;
+    }
+    return *semilla;
+}
+
+__attribute__((section(".tareastress_text"))) static void stress_calculo(uint32_t r)
+{
+    uint32_t num = 0;
+    unsigned int factores[12]; // Números menores a 1024: a lo sumo 10 factores más el 0 final
+
+    switch ((r >> 8) & 3U)
+    {
+    case 0:
+        // Árbol de recursión chico: la pila SYS de la tarea es de 512 bytes
+        fibonacci(6U + (r & 3U));
+        break;
+    case 1:
+        num = 1U + ((r >> 12) & 0x3FU);
+        while (num != 1)
+        {
+            num = conjetura_collatz(num);
+        }
+        break;
+    default:
+        factorizacion_primos(2U + ((r >> 12) & 0x3FFU), factores);
+        break;
+    }
+}
+
+__attribute__((section(".tareastress_text"))) void tarea_stress(void)
+{
+    uint32_t n = (uint32_t)my_getpid() - TASK_STRESS_BASE;
+    uint32_t semilla = 0xACE1U + n * 0x9E3779B9U; // Cada tarea sigue su propia secuencia
+    uint32_t r = 0;
+    uint32_t peso = 0;
+    timespec_t ts;
+
+    while (1)
+    {
+        // Cada vuelta es un item de trabajo, elegido al azar según los pesos de la mezcla
+        r = stress_aleatorio(&semilla);
+        peso = r - div(r, STRESS_PESO_TOTAL) * STRESS_PESO_TOTAL;
+        if (peso < STRESS_PESO_CALCULO)
+        {
+            stress_calculo(r);
+        }
+        else if (peso < STRESS_PESO_CALCULO + STRESS_PESO_SYSCALL)
+        {
+            my_clock_gettime(CLOCK_MONOTONIC, &ts);
+        }
+        else if (peso < STRESS_PESO_CALCULO + STRESS_PESO_SYSCALL + STRESS_PESO_SALIDA)
+        {
+            my_printf(".");
+        }
+        else
+        {
+            my_dormir(1U + ((r >> 16) & 3U));
+        }
+        stress_items[n]++;
+    }
+}
+
+#endif // STRESS_TAREAS > 0
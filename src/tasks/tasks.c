@@ -36,6 +36,9 @@ __attribute__((section(".tareaidle_text"))) void tarea_idle(void)
 {
     while (1)
     {
+        // Aprovecha el tiempo ocioso para medir el uso de las pilas y procesar envíos de los anillos
+        stack_scan_step();
+        anillos_idle();
         HALT_CPU;
     }
 }
@@ -49,8 +52,13 @@ __attribute__((section(".tarea1_text"))) void tarea1(void)
         my_printf("Cálculo del número de Fibonacci:\n");
         for (i = 0; i < 10; i++)
         {
+#ifdef BITACORA
+            BITACORA_INFO("Fibonacci(%u) = %u\n", i, fibonacci(i));
+#else
             printf("Fibonacci(%u) = %u\n", i, fibonacci(i));
+#endif
         }
+        my_rt_esperar_periodo();
     }
 }
 
@@ -72,9 +80,51 @@ __attribute__((section(".tarea2_text"))) void tarea2(void)
             }
             my_printf("1\n");
         }
+        my_rt_esperar_periodo();
     }
 }
 
+#ifdef FIBRAS_DEMO
+// Cada vuelta de una fibra hace E/S bloqueante por el anillo de la tarea: solo se bloquea la fibra
+__attribute__((section(".tarea3_text"))) static void tarea3_fibra(void *arg)
+{
+    static const char *const mensajes[] = {"[fibra 0] E/S completada\n", "[fibra 1] E/S completada\n",
+                                           "[fibra 2] E/S completada\n", "[fibra 3] E/S completada\n"};
+    uint32_t n = (uint32_t)arg;
+    uint32_t i = 0;
+    timespec_t ts;
+
+    for (i = 0; i < FIBRAS_DEMO_VUELTAS; i++)
+    {
+        (void)fibra_io(ANILLO_OP_CLOCK, CLOCK_MONOTONIC, (uint32_t)&ts);
+        (void)fibra_io(ANILLO_OP_WRITE, (uint32_t)mensajes[n & 3U], 0);
+        fibra_dormir(n + 1U);
+    }
+}
+
+__attribute__((section(".tarea3_text"))) void tarea3(void)
+{
+    uint32_t i = 0;
+    fibras_t fibras;
+
+    // El anillo y las pilas de las fibras salen de la arena de heap de la tarea
+    if (fibras_init(&fibras, FIBRAS_ANILLO_CANT) != 0)
+    {
+        my_printf("[fibras] el anillo no entra en la arena\n");
+        my_exit();
+    }
+    while (1)
+    {
+        for (i = 0; i < FIBRAS_DEMO; i++)
+        {
+            (void)fibra_crear(tarea3_fibra, (void *)i, FIBRAS_DEMO_PILA);
+        }
+        fibras_correr();
+        printf("Fibras: %u cambios, %u esperas de la tarea\n", fibras.stats.cambios, fibras.stats.esperas);
+        my_rt_esperar_periodo();
+    }
+}
+#else
 __attribute__((section(".tarea3_text"))) void tarea3(void)
 {
     uint32_t i = 0;
@@ -92,5 +142,7 @@ __attribute__((section(".tarea3_text"))) void tarea3(void)
         }
         my_printf("\n");
         my_printf("Factorización completa.\n");
+        my_rt_esperar_periodo();
     }
 }
+#endif
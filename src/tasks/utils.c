@@ -31,7 +31,7 @@
 #include "defines.h"
 #include "utils/console_utils.h"
 
-__attribute__((section(".text"))) int raiz_cuadrada_int(unsigned int x)
+SECCION_TEXT int raiz_cuadrada_int(unsigned int x)
 {
     unsigned int b, h, last;
     int ret = -1; // Valor de retorno por defecto en caso de error
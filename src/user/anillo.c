@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    anillo.c
+ * @brief   Interfaz de usuario de los anillos de envío y de completado
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+SECCION_TEXT int anillo_registrar(anillo_t *a, uint32_t sq_cant)
+{
+    int ret = -1;
+    __asm__ volatile("MOV R0, %1\n\t"
+                     "MOV R1, %2\n\t"
+                     SVC_INSTR("%3")
+                     "MOV %0, R0"
+                     : "=r"(ret)
+                     : "r"(a), "r"(sq_cant), "i"(SYS_RING_SETUP)
+                     : "r0", "r1", "r12", "memory");
+    return ret;
+}
+
+SECCION_TEXT anillo_t *anillo_crear(uint32_t sq_cant)
+{
+    anillo_t *a = (anillo_t *)heap_alloc(ANILLO_TAM(sq_cant));
+
+    if (a != NULL && anillo_registrar(a, sq_cant) != 0)
+    {
+        heap_free(a);
+        a = NULL;
+    }
+    return a;
+}
+
+SECCION_TEXT anillo_sqe_t *anillo_sqe(anillo_t *a)
+{
+    anillo_sqe_t *sqe = NULL;
+    if (a->sq_local - a->sq_cabeza < a->sq_cant)
+    {
+        sqe = &ANILLO_SQ(a)[a->sq_local & (a->sq_cant - 1U)];
+        a->sq_local++;
+    }
+    return sqe;
+}
+
+SECCION_TEXT void anillo_publicar(anillo_t *a)
+{
+    __asm__ volatile("DMB" : : : "memory"); // Las entradas antes que el índice
+    a->sq_cola = a->sq_local;
+}
+
+SECCION_TEXT int anillo_enter(uint32_t esperar)
+{
+    int ret = -1;
+    __asm__ volatile("MOV R0, %1\n\t"
+                     SVC_INSTR("%2")
+                     "MOV %0, R0"
+                     : "=r"(ret)
+                     : "r"(esperar), "i"(SYS_RING_ENTER)
+                     : "r0", "r12", "memory");
+    return ret;
+}
+
+SECCION_TEXT int anillo_cqe(anillo_t *a, anillo_cqe_t *cqe)
+{
+    int ret = 0;
+    if (a->cq_cabeza != a->cq_cola)
+    {
+        __asm__ volatile("DMB" : : : "memory"); // El índice antes que la entrada
+        *cqe = ANILLO_CQ(a, a->sq_cant)[a->cq_cabeza & (ANILLO_CQ_CANT(a->sq_cant) - 1U)];
+        __asm__ volatile("DMB" : : : "memory"); // Leída antes de liberar el lugar
+        a->cq_cabeza++;
+        ret = 1;
+    }
+    return ret;
+}
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    fibra.c
+ * @brief   Fibras de usuario: planificador cooperativo por tarea sobre la arena de heap y los anillos
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+extern void fibra_arranque(void);
+void fibra_entrada(fibra_t *fb);
+
+SECCION_TEXT static fibras_t *fibras_actuales(void)
+{
+    heap_arena_t *a = heap_arena_actual();
+    return (a != NULL) ? (fibras_t *)a->fibras : NULL;
+}
+
+SECCION_TEXT static void fibras_encolar(fibras_t *f, fibra_t *fb)
+{
+    fb->estado = FIBRA_LISTA;
+    fb->sig = NULL;
+    if (f->listas_fin == NULL)
+    {
+        f->listas = fb;
+    }
+    else
+    {
+        f->listas_fin->sig = fb;
+    }
+    f->listas_fin = fb;
+}
+
+SECCION_TEXT static fibra_t *fibras_sacar(fibras_t *f)
+{
+    fibra_t *fb = f->listas;
+    if (fb != NULL)
+    {
+        f->listas = fb->sig;
+        if (f->listas == NULL)
+        {
+            f->listas_fin = NULL;
+        }
+    }
+    return fb;
+}
+
+SECCION_TEXT static void fibras_despertar_dormidas(fibras_t *f)
+{
+    fibra_t *fb;
+    while (f->dormidas != NULL && (int32_t)(f->ticks - f->dormidas->despertar) >= 0)
+    {
+        fb = f->dormidas;
+        f->dormidas = fb->sig;
+        fibras_encolar(f, fb);
+    }
+}
+
+// Lee las completions sin entrar al kernel y deja listas a las fibras que las esperaban
+SECCION_TEXT static void fibras_cosechar(fibras_t *f)
+{
+    anillo_cqe_t cqe;
+    fibra_t *fb;
+
+    if (f->anillo == NULL)
+    {
+        return;
+    }
+    while (anillo_cqe(f->anillo, &cqe) == 1)
+    {
+        f->en_vuelo--;
+        if (cqe.user_data == FIBRAS_UD_TICK)
+        {
+            // Con res < 0 el kernel no tenía lugar para otro timer: se vuelve a armar sin contar el tick
+            f->timer_armado = 0;
+            if (cqe.res == 0)
+            {
+                f->ticks++;
+                fibras_despertar_dormidas(f);
+            }
+        }
+        else
+        {
+            fb = (fibra_t *)cqe.user_data;
+            fb->res = cqe.res;
+            fibras_encolar(f, fb);
+        }
+    }
+}
+
+SECCION_TEXT static void fibras_enviar(fibras_t *f, uint32_t op, uint32_t arg0, uint32_t arg1, uint32_t user_data)
+{
+    anillo_sqe_t *sqe;
+
+    while ((sqe = anillo_sqe(f->anillo)) == NULL)
+    {
+        // Anillo de envío lleno: que el kernel procese lo publicado, dejando lugar para sus completions
+        fibras_cosechar(f);
+        anillo_enter(0);
+    }
+    sqe->op = op;
+    sqe->arg0 = arg0;
+    sqe->arg1 = arg1;
+    sqe->user_data = user_data;
+    anillo_publicar(f->anillo);
+    f->en_vuelo++;
+}
+
+// Un solo timer del kernel por tarea, de un tick, y solo mientras haya fibras dormidas
+SECCION_TEXT static void fibras_armar_timer(fibras_t *f)
+{
+    if (f->dormidas != NULL && f->timer_armado == 0)
+    {
+        f->timer_armado = 1;
+        fibras_enviar(f, ANILLO_OP_TIMER, 1U, 0, FIBRAS_UD_TICK);
+    }
+}
+
+SECCION_TEXT static void fibras_liberar(fibras_t *f)
+{
+    if (f->a_liberar != NULL)
+    {
+        heap_free(f->a_liberar);
+        f->a_liberar = NULL;
+    }
+}
+
+// Deja la fibra actual (ya encolada, bloqueada, dormida o terminada) y sigue en la próxima lista.
+// Si no hay ninguna vuelve al contexto principal, que decide si la tarea duerme.
+SECCION_TEXT static void fibras_salir(fibras_t *f, fibra_t *fb)
+{
+    fibra_t *sig;
+
+    if (fb->canario != FIBRA_CANARIO)
+    {
+        my_printf("[fibras] desborde de pila de una fibra\n");
+        my_exit();
+    }
+    sig = fibras_sacar(f);
+    f->actual = sig;
+    f->stats.cambios++;
+    fibra_cambiar(&fb->sp, (sig != NULL) ? sig->sp : f->sp_principal);
+    fibras_liberar(f);
+}
+
+SECCION_TEXT void fibra_entrada(fibra_t *fb)
+{
+    fibras_t *f = fibras_actuales();
+
+    fibras_liberar(f);
+    fb->funcion(fb->arg);
+    fb->estado = FIBRA_TERMINADA;
+    f->vivas--;
+    f->a_liberar = fb; // Todavía corre sobre esta pila: la libera quien siga
+    fibras_salir(f, fb);
+}
+
+SECCION_TEXT int fibras_init(fibras_t *f, uint32_t anillo_cant)
+{
+    heap_arena_t *arena = heap_arena_actual();
+    anillo_t *a = NULL;
+
+    if (f == NULL || arena == NULL)
+    {
+        return -1;
+    }
+    if (anillo_cant > 0)
+    {
+        a = anillo_crear(anillo_cant);
+        if (a == NULL)
+        {
+            return -1;
+        }
+    }
+    f->actual = NULL;
+    f->listas = NULL;
+    f->listas_fin = NULL;
+    f->dormidas = NULL;
+    f->a_liberar = NULL;
+    f->sp_principal = NULL;
+    f->anillo = a;
+    f->ticks = 0;
+    f->vivas = 0;
+    f->en_vuelo = 0;
+    f->timer_armado = 0;
+    f->stats.cambios = 0;
+    f->stats.creadas = 0;
+    f->stats.esperas = 0;
+    arena->fibras = f;
+    return 0;
+}
+
+SECCION_TEXT fibra_t *fibra_crear(void (*funcion)(void *), void *arg, uint32_t pila)
+{
+    fibras_t *f = fibras_actuales();
+    fibra_t *fb;
+    uint32_t *tope;
+    uint32_t i = 0;
+
+    if (f == NULL || funcion == NULL)
+    {
+        return NULL;
+    }
+    if (pila == 0)
+    {
+        pila = FIBRA_PILA;
+    }
+    if (pila < FIBRA_PILA_MIN)
+    {
+        pila = FIBRA_PILA_MIN;
+    }
+    fb = (fibra_t *)heap_alloc(pila);
+    if (fb == NULL)
+    {
+        return NULL;
+    }
+    fb->funcion = funcion;
+    fb->arg = arg;
+    fb->despertar = 0;
+    fb->res = 0;
+    fb->canario = FIBRA_CANARIO;
+
+    // Frame inicial como lo deja fibra_cambiar: R4 = la fibra, PC = fibra_arranque. SP alineado a 8 (AAPCS)
+    tope = (uint32_t *)(((uint32_t)fb + pila) & ~7U);
+    fb->sp = tope - FIBRA_FRAME_PALABRAS;
+    fb->sp[0] = (uint32_t)fb;
+    for (i = 1; i < FIBRA_FRAME_PALABRAS - 1U; i++)
+    {
+        fb->sp[i] = 0;
+    }
+    fb->sp[FIBRA_FRAME_PALABRAS - 1U] = (uint32_t)fibra_arranque;
+
+    f->vivas++;
+    f->stats.creadas++;
+    fibras_encolar(f, fb);
+    return fb;
+}
+
+SECCION_TEXT void fibras_correr(void)
+{
+    fibras_t *f = fibras_actuales();
+    fibra_t *fb;
+
+    if (f == NULL || f->actual != NULL)
+    {
+        return; // Solo desde el contexto principal de la tarea
+    }
+    while (f->vivas > 0)
+    {
+        fibras_cosechar(f);
+        fibras_armar_timer(f);
+        fb = fibras_sacar(f);
+        if (fb != NULL)
+        {
+            f->actual = fb;
+            f->stats.cambios++;
+            fibra_cambiar(&f->sp_principal, fb->sp);
+            fibras_liberar(f);
+        }
+        else if (f->en_vuelo > 0)
+        {
+            // Todas esperan E/S o un timer: la tarea entera duerme hasta la próxima completion
+            f->stats.esperas++;
+            anillo_enter(1);
+        }
+        else
+        {
+            break; // Quedan fibras que ya no pueden volver a estar listas
+        }
+    }
+}
+
+SECCION_TEXT void fibra_ceder(void)
+{
+    fibras_t *f = fibras_actuales();
+    fibra_t *fb;
+
+    if (f == NULL || (fb = f->actual) == NULL)
+    {
+        return;
+    }
+    fibras_cosechar(f);
+    fibras_armar_timer(f);
+    if (f->listas != NULL)
+    {
+        fibras_encolar(f, fb);
+        fibras_salir(f, fb);
+    }
+}
+
+SECCION_TEXT void fibra_dormir(uint32_t ticks)
+{
+    fibras_t *f = fibras_actuales();
+    fibra_t *fb;
+    fibra_t **p;
+
+    if (f == NULL || (fb = f->actual) == NULL)
+    {
+        return;
+    }
+    if (f->anillo == NULL)
+    {
+        fibra_ceder();
+        return;
+    }
+    // Primero las completions pendientes: después de insertarla, un tick podría despertarla acá mismo
+    fibras_cosechar(f);
+    fb->despertar = f->ticks + ticks;
+    fb->estado = FIBRA_DORMIDA;
+    p = &f->dormidas;
+    while (*p != NULL && (int32_t)((*p)->despertar - fb->despertar) <= 0)
+    {
+        p = &(*p)->sig;
+    }
+    fb->sig = *p;
+    *p = fb;
+    fibras_armar_timer(f);
+    fibras_salir(f, fb);
+}
+
+SECCION_TEXT int32_t fibra_io(uint32_t op, uint32_t arg0, uint32_t arg1)
+{
+    fibras_t *f = fibras_actuales();
+    fibra_t *fb;
+
+    if (f == NULL || (fb = f->actual) == NULL || f->anillo == NULL)
+    {
+        return -1;
+    }
+    fibras_cosechar(f);
+    fibras_armar_timer(f);
+    fb->estado = FIBRA_BLOQUEADA;
+    fibras_enviar(f, op, arg0, arg1, (uint32_t)fb);
+    fibras_salir(f, fb);
+    return fb->res;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    heap.c
+ * @brief   Heap de usuario: una arena por tarea con listas libres por clase de tamaño
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+// Primer byte entregable de la arena: la cabecera va al principio de la región
+#define HEAP_INICIO(a) ((uint8_t *)(a) + ((sizeof(heap_arena_t) + HEAP_ALINEACION - 1U) & ~(HEAP_ALINEACION - 1U)))
+
+SECCION_TEXT heap_arena_t *heap_arena_init(void *region, uint32_t tam)
+{
+    uint32_t i = 0;
+    heap_arena_t *a = (heap_arena_t *)region;
+
+    a->fin = (uint8_t *)region + tam;
+    a->brk = HEAP_INICIO(a);
+    for (i = 0; i < HEAP_CANT_CLASES; i++)
+    {
+        a->libres[i] = NULL;
+    }
+    a->grandes = NULL;
+    a->stats.allocs = 0;
+    a->stats.frees = 0;
+    a->stats.fallos = 0;
+    a->stats.en_uso = 0;
+    a->fibras = NULL;
+#ifdef NEWLIB
+    _REENT_INIT_PTR(&a->reent);
+#endif
+    return a;
+}
+
+SECCION_TEXT heap_arena_t *heap_arena_actual(void)
+{
+    heap_arena_t *a;
+    __asm__ volatile("MRC p15, 0, %0, c13, c0, 3" : "=r"(a)); // TPIDRURO
+    return a;
+}
+
+SECCION_TEXT static void *heap_sbrk_arena(heap_arena_t *a, ptrdiff_t incr)
+{
+    uint8_t *anterior = a->brk;
+
+    if ((incr > 0 && (uint32_t)incr > (uint32_t)(a->fin - a->brk)) ||
+        (incr < 0 && (uint32_t)(-incr) > (uint32_t)(a->brk - HEAP_INICIO(a))))
+    {
+        return (void *)-1;
+    }
+    a->brk += incr;
+    return anterior;
+}
+
+SECCION_TEXT void *heap_sbrk(ptrdiff_t incr)
+{
+    heap_arena_t *a = heap_arena_actual();
+    return (a != NULL) ? heap_sbrk_arena(a, incr) : (void *)-1;
+}
+
+SECCION_TEXT static uint32_t heap_clase(size_t tam)
+{
+    uint32_t clase = 0;
+    while (clase < HEAP_CANT_CLASES && ((size_t)1U << (clase + HEAP_CLASE_MIN_LOG2)) < tam)
+    {
+        clase++;
+    }
+    return clase;
+}
+
+SECCION_TEXT static heap_bloque_t *heap_grande(heap_arena_t *a, uint32_t tam)
+{
+    void **prev = &a->grandes;
+    void *libre = a->grandes;
+    heap_bloque_t *b = NULL;
+
+    // Primer ajuste sin partir: los bloques grandes son raros y suelen repetir tamaño (buffers de stdio)
+    while (libre != NULL)
+    {
+        b = (heap_bloque_t *)libre - 1;
+        if (b->tam >= tam)
+        {
+            *prev = *(void **)libre;
+            return b;
+        }
+        prev = (void **)libre;
+        libre = *(void **)libre;
+    }
+    b = (heap_bloque_t *)heap_sbrk_arena(a, (ptrdiff_t)(sizeof(heap_bloque_t) + tam));
+    if (b == (heap_bloque_t *)-1)
+    {
+        return NULL;
+    }
+    b->clase = HEAP_CLASE_GRANDE;
+    b->tam = tam;
+    return b;
+}
+
+SECCION_TEXT void *heap_alloc(size_t tam)
+{
+    heap_arena_t *a = heap_arena_actual();
+    heap_bloque_t *b = NULL;
+    uint32_t clase = 0;
+
+    if (a == NULL)
+    {
+        return NULL;
+    }
+    clase = heap_clase(tam);
+    if (clase < HEAP_CANT_CLASES)
+    {
+        if (a->libres[clase] != NULL)
+        {
+            // Camino rápido: sacar de la lista de la clase
+            b = (heap_bloque_t *)a->libres[clase] - 1;
+            a->libres[clase] = *(void **)a->libres[clase];
+        }
+        else
+        {
+            b = (heap_bloque_t *)heap_sbrk_arena(a, (ptrdiff_t)(sizeof(heap_bloque_t) +
+                                                                 (1U << (clase + HEAP_CLASE_MIN_LOG2))));
+            if (b == (heap_bloque_t *)-1)
+            {
+                b = NULL;
+            }
+            else
+            {
+                b->clase = clase;
+                b->tam = 1U << (clase + HEAP_CLASE_MIN_LOG2);
+            }
+        }
+    }
+    else if (tam <= (size_t)(a->fin - a->brk))
+    {
+        b = heap_grande(a, ((uint32_t)tam + HEAP_ALINEACION - 1U) & ~(HEAP_ALINEACION - 1U));
+    }
+
+    if (b == NULL)
+    {
+        a->stats.fallos++;
+        return NULL;
+    }
+    a->stats.allocs++;
+    a->stats.en_uso += b->tam;
+    return b + 1;
+}
+
+SECCION_TEXT void heap_free(void *ptr)
+{
+    heap_arena_t *a = heap_arena_actual();
+    heap_bloque_t *b = NULL;
+
+    if (ptr == NULL || a == NULL)
+    {
+        return;
+    }
+    b = (heap_bloque_t *)ptr - 1;
+    a->stats.frees++;
+    a->stats.en_uso -= b->tam;
+    if (b->clase < HEAP_CANT_CLASES)
+    {
+        *(void **)ptr = a->libres[b->clase];
+        a->libres[b->clase] = ptr;
+    }
+    else
+    {
+        *(void **)ptr = a->grandes;
+        a->grandes = ptr;
+    }
+}
+
+SECCION_TEXT size_t heap_tam_util(void *ptr)
+{
+    return (ptr != NULL) ? ((heap_bloque_t *)ptr - 1)->tam : 0U;
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2025 Enzo Belmonte
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * @file    newlib.c
+ * @brief   Adaptación de la newlib (make NEWLIB=1): llamadas al sistema y malloc sobre la arena de la tarea
+ * @author  Enzo Belmonte <ebelmonte@frba.utn.edu.ar>
+ * @date    2026-10-19
+ */
+#include "defines.h"
+
+#ifdef NEWLIB
+
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <reent.h>
+
+/*
+    Llamadas al sistema que usa la newlib. stdin, stdout y stderr son la UART0.
+    errno es el de la struct _reent de la tarea: el kernel cambia _impure_ptr en cada cambio de contexto.
+*/
+
+SECCION_TEXT int _write(int fd, const char *buf, int len)
+{
+    int ret = -1;
+    if (fd == 1 || fd == 2)
+    {
+        ret = my_printf_len(buf, (size_t)len);
+    }
+    if (ret < 0)
+    {
+        errno = EBADF;
+    }
+    return ret;
+}
+
+SECCION_TEXT int _read(int fd, char *buf, int len)
+{
+    int ret = -1;
+    if (fd == 0 && len > 0)
+    {
+        ret = my_read(0, buf, (unsigned int)len);
+    }
+    else if (len == 0)
+    {
+        ret = 0;
+    }
+    if (ret < 0)
+    {
+        errno = EBADF;
+    }
+    return ret;
+}
+
+SECCION_TEXT void *_sbrk(ptrdiff_t incr)
+{
+    void *ret = heap_sbrk(incr);
+    if (ret == (void *)-1)
+    {
+        errno = ENOMEM;
+    }
+    return ret;
+}
+
+SECCION_TEXT void _exit(int status)
+{
+    (void)status;
+    my_exit();
+}
+
+SECCION_TEXT int _close(int fd)
+{
+    (void)fd;
+    errno = EBADF;
+    return -1;
+}
+
+SECCION_TEXT int _fstat(int fd, struct stat *st)
+{
+    if (fd < 0 || fd > 2)
+    {
+        errno = EBADF;
+        return -1;
+    }
+    // Dispositivo de caracteres: la newlib usa buffer de línea en stdout
+    memset(st, 0, sizeof(*st));
+    st->st_mode = S_IFCHR;
+    return 0;
+}
+
+SECCION_TEXT int _isatty(int fd)
+{
+    if (fd < 0 || fd > 2)
+    {
+        errno = EBADF;
+        return 0;
+    }
+    return 1;
+}
+
+SECCION_TEXT int _lseek(int fd, int off, int whence)
+{
+    (void)fd;
+    (void)off;
+    (void)whence;
+    errno = ESPIPE;
+    return -1;
+}
+
+SECCION_TEXT int _kill(int pid, int sig)
+{
+    (void)pid;
+    (void)sig;
+    errno = EINVAL;
+    return -1;
+}
+
+SECCION_TEXT int _getpid(void)
+{
+    return my_getpid();
+}
+
+/*
+    malloc de la newlib reemplazado por el heap de la tarea: sin __malloc_lock porque la arena no se comparte.
+    Al definir todas las variantes _r, el linker no trae el malloc de la libc.
+*/
+
+SECCION_TEXT void *_malloc_r(struct _reent *r, size_t tam)
+{
+    void *ptr = heap_alloc(tam);
+    if (ptr == NULL)
+    {
+        r->_errno = ENOMEM;
+    }
+    return ptr;
+}
+
+SECCION_TEXT void _free_r(struct _reent *r, void *ptr)
+{
+    (void)r;
+    heap_free(ptr);
+}
+
+SECCION_TEXT void *_calloc_r(struct _reent *r, size_t n, size_t tam)
+{
+    void *ptr = NULL;
+    if (tam != 0 && n > (size_t)-1 / tam)
+    {
+        r->_errno = ENOMEM;
+        return NULL;
+    }
+    ptr = _malloc_r(r, n * tam);
+    if (ptr != NULL)
+    {
+        memset(ptr, 0, n * tam);
+    }
+    return ptr;
+}
+
+SECCION_TEXT void *_realloc_r(struct _reent *r, void *ptr, size_t tam)
+{
+    void *nuevo = NULL;
+    size_t util = heap_tam_util(ptr);
+
+    if (ptr == NULL)
+    {
+        return _malloc_r(r, tam);
+    }
+    if (tam <= util)
+    {
+        return ptr; // Entra en la clase que ya tiene
+    }
+    nuevo = _malloc_r(r, tam);
+    if (nuevo != NULL)
+    {
+        memcpy(nuevo, ptr, util);
+        heap_free(ptr);
+    }
+    return nuevo;
+}
+
+SECCION_TEXT void *_memalign_r(struct _reent *r, size_t alin, size_t tam)
+{
+    // Los bloques salen alineados a 8: no hay soporte para alineaciones mayores
+    if (alin > HEAP_ALINEACION)
+    {
+        r->_errno = EINVAL;
+        return NULL;
+    }
+    return _malloc_r(r, tam);
+}
+
+SECCION_TEXT size_t _malloc_usable_size_r(struct _reent *r, void *ptr)
+{
+    (void)r;
+    return heap_tam_util(ptr);
+}
+
+SECCION_TEXT void *malloc(size_t tam)
+{
+    return _malloc_r(_REENT, tam);
+}
+
+SECCION_TEXT void free(void *ptr)
+{
+    heap_free(ptr);
+}
+
+SECCION_TEXT void *calloc(size_t n, size_t tam)
+{
+    return _calloc_r(_REENT, n, tam);
+}
+
+SECCION_TEXT void *realloc(void *ptr, size_t tam)
+{
+    return _realloc_r(_REENT, ptr, tam);
+}
+
+#endif // NEWLIB
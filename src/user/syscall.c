@@ -29,14 +29,151 @@
 #include "defines.h"
 #include "user/syscall.h"
 
-__attribute__((section(".text"))) int my_printf(const char *buf)
+SECCION_TEXT int my_printf(const char *buf)
 {
     int ret = -1; // Valor de retorno por defecto en caso de error
     if (buf != NULL)
     {
-        __asm__("MOV R0, %0" : : "r"(buf));
-        __asm__("SVC %0" : : "i"(SYS_WRITE));
-        __asm__("MOV %0, R0" : "=r"(ret));
+        __asm__ volatile("MOV R0, %1\n\t"
+                         SVC_INSTR("%2")
+                         "MOV %0, R0"
+                         : "=r"(ret)
+                         : "r"(buf), "i"(SYS_WRITE)
+                         : "r0", "r12", "memory");
     }
     return ret;
 }
+
+SECCION_TEXT int my_printf_len(const char *buf, size_t len)
+{
+    int ret = -1;
+    if (buf != NULL)
+    {
+        __asm__ volatile("MOV R0, %1\n\t"
+                         "MOV R1, %2\n\t"
+                         SVC_INSTR("%3")
+                         "MOV %0, R0"
+                         : "=r"(ret)
+                         : "r"(buf), "r"(len), "i"(SYS_WRITE_LEN)
+                         : "r0", "r1", "r12", "memory");
+    }
+    return ret;
+}
+
+#ifdef BITACORA
+SECCION_TEXT int my_bitacora(unsigned int cabecera, ...)
+{
+    int ret = -1;
+    uint32_t reg[BITACORA_REG_PALABRAS];
+    uint32_t len;
+    _timer_t *TIMER = (_timer_t *)clock_page.timer_addr;
+    va_list args;
+
+    // El registro se arma acá: al kernel solo le llegan los bytes a enviar
+    va_start(args, cabecera);
+    len = bitacora_armar(reg, cabecera, 0xFFFFFFFFU - TIMER->Timer1Value, args);
+    va_end(args);
+    __asm__ volatile("MOV R0, %1\n\t"
+                     "MOV R1, %2\n\t"
+                     SVC_INSTR("%3")
+                     "MOV %0, R0"
+                     : "=r"(ret)
+                     : "r"(reg), "r"(len), "i"(SYS_LOG)
+                     : "r0", "r1", "r12", "memory");
+    return ret;
+}
+#endif
+
+SECCION_TEXT int my_consola(unsigned int canal)
+{
+    int ret = -1;
+    __asm__ volatile("MOV R0, %1\n\t"
+                     SVC_INSTR("%2")
+                     "MOV %0, R0"
+                     : "=r"(ret)
+                     : "r"(canal), "i"(SYS_CONSOLE_BIND)
+                     : "r0", "r12", "memory");
+    return ret;
+}
+
+SECCION_TEXT int my_read(unsigned int fd, void *buf, unsigned int len)
+{
+    int ret = -1;
+    // Si no había datos el kernel duerme a la tarea y repite la lectura al despertarla
+    __asm__ volatile("MOV R0, %1\n\t"
+                     "MOV R1, %2\n\t"
+                     "MOV R2, %3\n\t"
+                     SVC_INSTR("%4")
+                     "MOV %0, R0"
+                     : "=r"(ret)
+                     : "r"(fd), "r"(buf), "r"(len), "i"(SYS_READ)
+                     : "r0", "r1", "r2", "r12", "memory");
+    return ret;
+}
+
+SECCION_TEXT int stack_usage(unsigned int task_id, unsigned int modo)
+{
+    int ret = -1;
+    __asm__ volatile("MOV R0, %1\n\t"
+                     "MOV R1, %2\n\t"
+                     SVC_INSTR("%3")
+                     "MOV %0, R0"
+                     : "=r"(ret)
+                     : "r"(task_id), "r"(modo), "i"(SYS_STACK_USAGE)
+                     : "r0", "r1", "r12", "memory");
+    return ret;
+}
+
+SECCION_TEXT int my_clock_gettime(unsigned int clk_id, timespec_t *ts)
+{
+    int ret = -1;
+    __asm__ volatile("MOV R0, %1\n\t"
+                     "MOV R1, %2\n\t"
+                     SVC_INSTR("%3")
+                     "MOV %0, R0"
+                     : "=r"(ret)
+                     : "r"(clk_id), "r"(ts), "i"(SYS_CLOCK_GETTIME)
+                     : "r0", "r1", "r12", "memory");
+    return ret;
+}
+
+SECCION_TEXT void my_rt_esperar_periodo(void)
+{
+    // El kernel la saca de la CPU dentro de la llamada y vuelve recién en la próxima activación
+    __asm__ volatile(SVC_INSTR("%0") : : "i"(SYS_RT_WAIT) : "r0", "r12", "memory");
+}
+
+SECCION_TEXT void my_yield(void)
+{
+    __asm__ volatile(SVC_INSTR("%0") : : "i"(SYS_SCHED_YIELD) : "r0", "r12", "memory");
+}
+
+SECCION_TEXT int my_getpid(void)
+{
+    int ret = -1;
+    __asm__ volatile(SVC_INSTR("%1")
+                     "MOV %0, R0"
+                     : "=r"(ret)
+                     : "i"(SYS_GETPID)
+                     : "r0", "r12", "memory");
+    return ret;
+}
+
+SECCION_TEXT void my_dormir(unsigned int ticks)
+{
+    // El kernel la saca de la CPU dentro de la llamada y vuelve cuando vence el plazo
+    __asm__ volatile("MOV R0, %0\n\t"
+                     SVC_INSTR("%1")
+                     :
+                     : "r"(ticks), "i"(SYS_SLEEP_TICKS)
+                     : "r0", "r12", "memory");
+}
+
+SECCION_TEXT void my_exit(void)
+{
+    __asm__ volatile(SVC_INSTR("%0") : : "i"(SYS_EXIT) : "r0", "r12", "memory");
+    while (1)
+    {
+        NOP; // No vuelve: el kernel no la planifica más
+    }
+}